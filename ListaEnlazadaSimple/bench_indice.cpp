@@ -0,0 +1,121 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <new>
+#include <random>
+#include <vector>
+
+#include "lista.h"
+
+// Mide lo que cuesta el índice por valor de Lista<T>: memoria extra e inserción
+// más lenta a cambio de contiene / eliminar_valor en O(1) esperado.
+//
+//   g++ -std=c++17 -O2 bench_indice.cpp -o bench_indice
+//   ./bench_indice [elementos maximos]
+
+// ---------- Conteo de memoria ----------
+
+// Bytes vivos pedidos con new. La biblioteca estándar y delete de objetos
+// completos usan la versión con tamaño, así que se puede descontar al liberar.
+static std::size_t bytesVivos = 0;
+
+void* operator new(std::size_t n) {
+    void* p = std::malloc(n == 0 ? 1 : n);
+    if (p == nullptr) {
+        throw std::bad_alloc();
+    }
+    bytesVivos += n;
+    return p;
+}
+
+void operator delete(void* p) noexcept {
+    std::free(p);
+}
+
+void operator delete(void* p, std::size_t n) noexcept {
+    bytesVivos -= n;
+    std::free(p);
+}
+
+// ---------- Mediciones ----------
+
+using Reloj = std::chrono::steady_clock;
+
+double nanosegundosDesde(Reloj::time_point inicio) {
+    return std::chrono::duration<double, std::nano>(Reloj::now() - inicio).count();
+}
+
+struct Medicion {
+    double insercionNs;    // Por elemento.
+    std::size_t bytes;     // Lista (+ índice) completa.
+    double contieneNs;     // Por consulta.
+    double eliminarNs;     // Por eliminar_valor.
+};
+
+Medicion medir(const std::vector<int>& valores, bool conIndice, int consultas) {
+    Medicion m{};
+    std::size_t antes = bytesVivos;
+    Lista<int> lista;
+    if (conIndice) {
+        lista.activarIndice();
+    }
+
+    Reloj::time_point inicio = Reloj::now();
+    for (int v : valores) {
+        lista.insertar_final(v);
+    }
+    m.insercionNs = nanosegundosDesde(inicio) / static_cast<double>(valores.size());
+    m.bytes = bytesVivos - antes;
+
+    std::minstd_rand gen(99);
+    inicio = Reloj::now();
+    for (int i = 0; i < consultas; ++i) {
+        volatile bool encontrado = lista.contiene(valores[gen() % valores.size()]);
+        (void)encontrado;
+    }
+    m.contieneNs = nanosegundosDesde(inicio) / consultas;
+
+    inicio = Reloj::now();
+    for (int i = 0; i < consultas; ++i) {
+        lista.eliminar_valor(valores[gen() % valores.size()]);
+    }
+    m.eliminarNs = nanosegundosDesde(inicio) / consultas;
+    return m;
+}
+
+void imprimirFila(const char* nombre, const std::vector<int>& valores) {
+    int n = static_cast<int>(valores.size());
+    // Sin índice cada consulta recorre la lista: se usan menos para no tardar O(n^2).
+    int consultasLineales = std::min(1000, std::max(10, 10000000 / n));
+
+    Medicion sin = medir(valores, false, consultasLineales);
+    Medicion con = medir(valores, true, 1000);
+    std::cout << n << " " << nombre << " | " << sin.bytes << " | " << con.bytes << " | "
+              << static_cast<double>(con.bytes - sin.bytes) / n << " | "
+              << sin.insercionNs << " / " << con.insercionNs << " | "
+              << sin.contieneNs << " / " << con.contieneNs << " | "
+              << sin.eliminarNs << " / " << con.eliminarNs << "\n";
+}
+
+int main(int argc, char* argv[]) {
+    int maximo = (argc > 1) ? std::atoi(argv[1]) : 1000000;
+
+    std::cout << "elementos | bytes sin indice | bytes con indice | extra/elemento"
+              << " | insercion ns (sin/con) | contiene ns (sin/con) | eliminar_valor ns (sin/con)\n";
+    for (int n = 1000; n <= maximo; n *= 10) {
+        std::vector<int> valores(static_cast<std::size_t>(n));
+        std::mt19937 gen(static_cast<unsigned>(n));
+        for (int& v : valores) {
+            v = static_cast<int>(gen());
+        }
+        imprimirFila("distintos", valores);
+
+        // Caso adversario: cuatro valores repetidos n / 4 veces cada uno.
+        for (int& v : valores) {
+            v = static_cast<int>(gen() % 4);
+        }
+        imprimirFila("4 valores", valores);
+    }
+    return 0;
+}
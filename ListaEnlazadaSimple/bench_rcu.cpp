@@ -0,0 +1,158 @@
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <mutex>
+#include <random>
+#include <shared_mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "lista.h"
+#include "lista_rcu.h"
+
+// Mide cómo escala el rendimiento de lectura de ListaRCU con la cantidad de
+// hilos lectores mientras un hilo escritor modifica la lista al mismo tiempo.
+// Como referencia mide también Lista<T> protegida por un std::shared_mutex.
+//
+//   g++ -std=c++17 -O2 -pthread bench_rcu.cpp -o bench_rcu
+//   ./bench_rcu [elementos] [milisegundos por medicion]
+
+using Reloj = std::chrono::steady_clock;
+
+struct Medicion {
+    double lecturasPorSegundo;
+    double escriturasPorSegundo;
+};
+
+// Carga de escritura: modifica una posición y rota un elemento (fin -> inicio),
+// así el tamaño se mantiene y se ejercitan modificar, insertar_* y Eliminar.
+template <class L>
+void pasoEscritor(L& lista, std::minstd_rand& gen, int elementos, long& ops) {
+    int pos = static_cast<int>(gen() % static_cast<unsigned>(elementos));
+    lista.modificar(pos, static_cast<int>(gen()));
+    lista.insertar_inicio(static_cast<int>(gen()));
+    lista.Eliminar(elementos);
+    ops += 3;
+}
+
+Medicion medirRCU(int lectores, int elementos, int milisegundos) {
+    ListaRCU<int> lista;
+    for (int i = 0; i < elementos; ++i) {
+        lista.insertar_final(i);
+    }
+
+    std::atomic<bool> detener{false};
+    std::atomic<long> lecturas{0};
+    long escrituras = 0;
+
+    std::vector<std::thread> hilos;
+    for (int h = 0; h < lectores; ++h) {
+        hilos.emplace_back([&, h]() {
+            ListaRCU<int>::Lector lector(lista);
+            std::minstd_rand gen(static_cast<unsigned>(h + 1));
+            long propias = 0;
+            while (!detener.load(std::memory_order_relaxed)) {
+                int pos = static_cast<int>(gen() % static_cast<unsigned>(elementos));
+                volatile int dato = lector.obtenerDato(pos);
+                (void)dato;
+                ++propias;
+            }
+            lecturas.fetch_add(propias);
+        });
+    }
+
+    std::thread escritor([&]() {
+        std::minstd_rand gen(12345);
+        while (!detener.load(std::memory_order_relaxed)) {
+            pasoEscritor(lista, gen, elementos, escrituras);
+        }
+    });
+
+    Reloj::time_point inicio = Reloj::now();
+    std::this_thread::sleep_for(std::chrono::milliseconds(milisegundos));
+    detener.store(true);
+    for (std::thread& t : hilos) {
+        t.join();
+    }
+    escritor.join();
+    double segundos = std::chrono::duration<double>(Reloj::now() - inicio).count();
+    return Medicion{static_cast<double>(lecturas.load()) / segundos,
+                    static_cast<double>(escrituras) / segundos};
+}
+
+Medicion medirCandado(int lectores, int elementos, int milisegundos) {
+    Lista<int> lista;
+    std::shared_mutex candado;
+    for (int i = 0; i < elementos; ++i) {
+        lista.insertar_final(i);
+    }
+
+    std::atomic<bool> detener{false};
+    std::atomic<long> lecturas{0};
+    long escrituras = 0;
+
+    std::vector<std::thread> hilos;
+    for (int h = 0; h < lectores; ++h) {
+        hilos.emplace_back([&, h]() {
+            std::minstd_rand gen(static_cast<unsigned>(h + 1));
+            long propias = 0;
+            while (!detener.load(std::memory_order_relaxed)) {
+                int pos = static_cast<int>(gen() % static_cast<unsigned>(elementos));
+                std::shared_lock<std::shared_mutex> lectura(candado);
+                volatile int dato = lista.obtenerDato(pos);
+                (void)dato;
+                ++propias;
+            }
+            lecturas.fetch_add(propias);
+        });
+    }
+
+    std::thread escritor([&]() {
+        std::minstd_rand gen(12345);
+        while (!detener.load(std::memory_order_relaxed)) {
+            std::unique_lock<std::shared_mutex> escritura(candado);
+            pasoEscritor(lista, gen, elementos, escrituras);
+        }
+    });
+
+    Reloj::time_point inicio = Reloj::now();
+    std::this_thread::sleep_for(std::chrono::milliseconds(milisegundos));
+    detener.store(true);
+    for (std::thread& t : hilos) {
+        t.join();
+    }
+    escritor.join();
+    double segundos = std::chrono::duration<double>(Reloj::now() - inicio).count();
+    return Medicion{static_cast<double>(lecturas.load()) / segundos,
+                    static_cast<double>(escrituras) / segundos};
+}
+
+int main(int argc, char* argv[]) {
+    int elementos = (argc > 1) ? std::max(1, std::atoi(argv[1])) : 256;
+    int milisegundos = (argc > 2) ? std::max(1, std::atoi(argv[2])) : 500;
+
+    // Un núcleo queda para el escritor; el resto se reparte entre lectores.
+    int nucleos = static_cast<int>(std::thread::hardware_concurrency());
+    int maxLectores = std::max(1, std::min(nucleos - 1, ListaRCU<int>::MAX_LECTORES));
+
+    std::cout << "Elementos: " << elementos << ", nucleos: " << nucleos
+              << ", " << milisegundos << " ms por medicion\n";
+    std::cout << "lectores | RCU lecturas/s | RCU escrituras/s | candado lecturas/s | candado escrituras/s\n";
+    std::vector<int> cantidades;
+    for (int lectores = 1; lectores < maxLectores; lectores *= 2) {
+        cantidades.push_back(lectores);
+    }
+    cantidades.push_back(maxLectores);
+
+    for (int lectores : cantidades) {
+        Medicion rcu = medirRCU(lectores, elementos, milisegundos);
+        Medicion candado = medirCandado(lectores, elementos, milisegundos);
+        std::cout << lectores << " | " << rcu.lecturasPorSegundo << " | "
+                  << rcu.escriturasPorSegundo << " | " << candado.lecturasPorSegundo
+                  << " | " << candado.escriturasPorSegundo << "\n";
+    }
+    return 0;
+}
@@ -0,0 +1,107 @@
+#ifndef INDICE_VALORES_H
+#define INDICE_VALORES_H
+
+#include <cstddef>
+#include <functional>
+#include <unordered_map>
+#include <utility>
+
+template <class T>
+struct Nodo;
+
+// Índice secundario de Lista<T>: valor -> nodo anterior (nullptr si el nodo es
+// la cabeza). Guardar el anterior en vez del nodo permite desenlazarlo en O(1)
+// en una lista simple. Lista<T> lo mantiene en cada inserción, modificación y
+// eliminación a través de esta interfaz; solo se instancia IndiceHash<T> (y se
+// exige std::hash<T>) si se llama a Lista<T>::activarIndice.
+template <class T>
+class IndiceLista {
+public:
+    virtual ~IndiceLista() = default;
+
+    // Registra un nodo con el valor indicado que cuelga de anterior.
+    virtual void agregar(const T& valor, Nodo<T>* anterior) = 0;
+    // Olvida el nodo con el valor indicado que cuelga de anterior.
+    virtual void quitar(const T& valor, Nodo<T>* anterior) = 0;
+    // El nodo con ese valor que colgaba de anteriorViejo ahora cuelga de anteriorNuevo.
+    virtual void cambiarAnterior(const T& valor, Nodo<T>* anteriorViejo, Nodo<T>* anteriorNuevo) = 0;
+    // Busca un nodo con el valor indicado; devuelve false si no hay ninguno.
+    virtual bool buscar(const T& valor, Nodo<T>*& anterior) const = 0;
+
+    virtual std::size_t getTam() const = 0;
+};
+
+// Implementación con tablas hash. Cada nodo se identifica por su anterior (que
+// es único), así que hay una entrada por anterior y las entradas con el mismo
+// valor forman una cadena doble:
+//   valores:  valor -> primera entrada de su cadena
+//   entradas: anterior -> entradas previa y siguiente con el mismo valor
+// Agregar, quitar, cambiarAnterior y buscar son O(1) esperado aunque un valor
+// se repita muchas veces.
+template <class T, class Hash = std::hash<T>>
+class IndiceHash : public IndiceLista<T> {
+    struct Enlaces;
+    using Entradas = std::unordered_map<Nodo<T>*, Enlaces>;
+    using Entrada = typename Entradas::value_type;
+    struct Enlaces {
+        Entrada* previa;
+        Entrada* siguiente;
+    };
+
+    // Las direcciones de los elementos de unordered_map no cambian al crecer la
+    // tabla ni al extraer y reinsertar un nodo, así que sirven de enlaces.
+    std::unordered_map<T, Entrada*, Hash> valores;
+    Entradas entradas;
+
+public:
+    void agregar(const T& valor, Nodo<T>* anterior) override {
+        Entrada*& primera = valores[valor];
+        Entrada& nueva = *entradas.emplace(anterior, Enlaces{nullptr, primera}).first;
+        if (primera != nullptr) {
+            primera->second.previa = &nueva;
+        }
+        primera = &nueva;
+    }
+
+    void quitar(const T& valor, Nodo<T>* anterior) override {
+        auto it = entradas.find(anterior);
+        if (it == entradas.end()) {
+            return;
+        }
+        Enlaces enlaces = it->second;
+        if (enlaces.siguiente != nullptr) {
+            enlaces.siguiente->second.previa = enlaces.previa;
+        }
+        if (enlaces.previa != nullptr) {
+            enlaces.previa->second.siguiente = enlaces.siguiente;
+        } else if (enlaces.siguiente != nullptr) {
+            valores[valor] = enlaces.siguiente;
+        } else {
+            valores.erase(valor);
+        }
+        entradas.erase(it);
+    }
+
+    void cambiarAnterior(const T& valor, Nodo<T>* anteriorViejo, Nodo<T>* anteriorNuevo) override {
+        (void)valor;
+        // Cambia la clave sin mover la entrada: los enlaces que apuntan a ella siguen valiendo.
+        auto nodo = entradas.extract(anteriorViejo);
+        if (!nodo.empty()) {
+            nodo.key() = anteriorNuevo;
+            entradas.insert(std::move(nodo));
+        }
+    }
+
+    bool buscar(const T& valor, Nodo<T>*& anterior) const override {
+        auto it = valores.find(valor);
+        if (it == valores.end()) {
+            return false;
+        }
+        anterior = it->second->first;
+        return true;
+    }
+
+    std::size_t getTam() const override { return entradas.size(); }
+};
+
+#endif // INDICE_VALORES_H
@@ -1,27 +1,41 @@
+#include <algorithm>
 #include <array>
+#include <chrono>
+#include <fstream>
 #include <iostream>
 #include <limits>
+#include <memory>
+#include <random>
 #include <sstream>
 #include <string>
 #include <stdexcept>
+#include <vector>
 
 #include "lista.h"
+#include "lista_fija.h"
 
 // ---------- Utilidades de formateo ----------
 
+// Escribe el valor directamente en el flujo (sin construir un string intermedio).
 template <typename T>
-std::string formatearValor(const T& valor) {
-    std::ostringstream ss;
-    ss << valor;
-    return ss.str();
+void escribirValor(std::ostream& out, const T& valor) {
+    out << valor;
 }
 
 template <>
-std::string formatearValor<char>(const char& valor) {
+void escribirValor<char>(std::ostream& out, const char& valor) {
     if (valor == '\0') {
-        return "\\0";
+        out << "\\0";
+    } else {
+        out << valor;
     }
-    return std::string(1, valor);
+}
+
+template <typename T>
+std::string formatearValor(const T& valor) {
+    std::ostringstream ss;
+    escribirValor(ss, valor);
+    return ss.str();
 }
 
 void limpiarRestante() {
@@ -30,12 +44,30 @@ void limpiarRestante() {
 
 // ---------- Vista rápida de una lista ----------
 
+// Listas más largas se resumen con sus primeros valores para que el registro
+// de un escenario grande no crezca en forma cuadrática.
+const int LIMITE_VISTA_COMPLETA = 32;
+const int VALORES_EN_RESUMEN = 8;
+
 template <typename T>
 std::string vistaLinea(const Lista<T>& lista) {
     if (lista.Lista_Vacia()) {
         return "(vacia)";
     }
     std::ostringstream ss;
+    if (lista.getTam() > LIMITE_VISTA_COMPLETA) {
+        int mostrados = 0;
+        for (const T& valor : lista) {
+            if (mostrados == VALORES_EN_RESUMEN) {
+                break;
+            }
+            escribirValor(ss, valor);
+            ss << " ";
+            ++mostrados;
+        }
+        ss << "... (" << lista.getTam() << " elementos)";
+        return ss.str();
+    }
     lista.imprimir(ss);
     std::string resultado = ss.str();
     if (!resultado.empty() && resultado.back() == '\n') {
@@ -58,10 +90,10 @@ struct EscenarioConfig {
 };
 
 template <typename T>
-EscenarioConfig<T> obtenerConfigPorDefecto();
+constexpr EscenarioConfig<T> obtenerConfigPorDefecto();
 
 template <>
-EscenarioConfig<int> obtenerConfigPorDefecto<int>() {
+constexpr EscenarioConfig<int> obtenerConfigPorDefecto<int>() {
     return EscenarioConfig<int>{
         {10, 20, 30, 5, 4, 3, 15, 25, 35, 45},
         3,
@@ -73,7 +105,7 @@ EscenarioConfig<int> obtenerConfigPorDefecto<int>() {
 }
 
 template <>
-EscenarioConfig<double> obtenerConfigPorDefecto<double>() {
+constexpr EscenarioConfig<double> obtenerConfigPorDefecto<double>() {
     return EscenarioConfig<double>{
         {1.1, 2.2, 3.3, 4.4, 5.5, 6.6, 7.7, 8.8, 9.9, 10.1},
         2,
@@ -85,7 +117,7 @@ EscenarioConfig<double> obtenerConfigPorDefecto<double>() {
 }
 
 template <>
-EscenarioConfig<char> obtenerConfigPorDefecto<char>() {
+constexpr EscenarioConfig<char> obtenerConfigPorDefecto<char>() {
     return EscenarioConfig<char>{
         {'a', 'b', 'c', 'x', 'y', 'z', 'd', 'e', 'f', 'g'},
         4,
@@ -96,6 +128,45 @@ EscenarioConfig<char> obtenerConfigPorDefecto<char>() {
         'Z'};
 }
 
+// Mismas inserciones que llenarLista, sin registro ni heap: con valores
+// constantes la lista resultante se construye en tiempo de compilación.
+template <typename T, int N>
+constexpr ListaFija<T, N> prepararListaFija(const std::array<T, 10>& valores) {
+    static_assert(N >= 10, "la preparacion inserta 10 valores");
+    ListaFija<T, N> lista;
+    for (int i = 0; i < 3; ++i) {
+        lista.insertar_final(valores[static_cast<std::size_t>(i)]);
+    }
+    for (int i = 3; i < 6; ++i) {
+        lista.insertar_inicio(valores[static_cast<std::size_t>(i)]);
+    }
+    for (int i = 6; i < 10; ++i) {
+        lista.insertar_pos(valores[static_cast<std::size_t>(i)], lista.getTam() / 2);
+    }
+    return lista;
+}
+
+// Estado inicial de cada escenario por defecto, calculado por el compilador.
+// Solo sirven de verificación en compilación (static_assert): en ejecución
+// actualizarEscenario sigue armando la lista con llenarLista, porque el
+// registro de preparación describe cada inserción.
+constexpr ListaFija<int, 10> inicialEnteros =
+    prepararListaFija<int, 10>(obtenerConfigPorDefecto<int>().valores);
+constexpr ListaFija<double, 10> inicialReales =
+    prepararListaFija<double, 10>(obtenerConfigPorDefecto<double>().valores);
+constexpr ListaFija<char, 10> inicialCaracteres =
+    prepararListaFija<char, 10>(obtenerConfigPorDefecto<char>().valores);
+
+static_assert(inicialEnteros.getTam() == 10 && inicialEnteros.Lista_Llena(),
+              "el escenario de enteros inserta 10 valores");
+static_assert(inicialEnteros.obtenerDato(0) == 3 && inicialEnteros.obtenerDato(4) == 45 &&
+                  inicialEnteros.obtenerDato(9) == 30,
+              "el escenario de enteros queda como 3 4 5 25 45 35 15 10 20 30");
+static_assert(inicialReales.obtenerDato(0) == 6.6 && inicialReales.obtenerDato(9) == 3.3,
+              "el escenario de reales queda como 6.6 ... 3.3");
+static_assert(inicialCaracteres.obtenerDato(0) == 'z' && inicialCaracteres.obtenerDato(9) == 'c',
+              "el escenario de caracteres queda como z y x ... c");
+
 template <typename T>
 struct EscenarioResultado {
     std::string registroPreparacion;
@@ -111,64 +182,86 @@ struct EstadoEscenario {
     EscenarioConfig<T> configDefault;
     EscenarioResultado<T> resultado;
     bool necesitaActualizar{true};
+    GrabadorTraza* traza{nullptr};  // Grabador opcional de las listas del escenario.
 };
 
 // ---------- Funciones que ejecutan el flujo ----------
 
-template <typename T>
-std::string llenarLista(const std::string& nombreLista,
-                        Lista<T>& lista,
-                        const std::array<T, 10>& valores) {
-    std::ostringstream log;
+// Cantidad máxima de inserciones intermedias de llenarLista: cada una recorre
+// media lista, así que en escenarios grandes el resto se inserta al final.
+const std::size_t LIMITE_INTERMEDIAS = 100;
+
+// Inserta los valores en tres tandas (final, inicio y posiciones intermedias) y
+// escribe cada paso en log. Con 10 valores reparte 3, 3 y 4.
+template <typename T, typename Valores>
+void llenarLista(const std::string& nombreLista,
+                 Lista<T>& lista,
+                 const Valores& valores,
+                 std::ostream& log) {
+    MarcaFaseTraza fase(lista.getTraza(), lista.getIdTraza(), FaseTraza::Llenado);
+
+    std::size_t total = valores.size();
+    std::size_t alInicio = total * 3 / 10;
+    std::size_t intermedios = total - 2 * alInicio;
+    if (intermedios > LIMITE_INTERMEDIAS) {
+        intermedios = LIMITE_INTERMEDIAS;
+    }
+    std::size_t alFinal = total - alInicio - intermedios;
 
-    log << "\n--- Preparando " << nombreLista << " ---" << std::endl;
-    log << "Insertando 3 elementos al final:" << std::endl;
-    for (int i = 0; i < 3; ++i) {
+    log << "\n--- Preparando " << nombreLista << " ---\n";
+    log << "Insertando " << alFinal << " elementos al final:\n";
+    std::size_t i = 0;
+    for (; i < alFinal; ++i) {
         lista.insertar_final(valores[i]);
-        log << "  final += " << formatearValor(valores[i]) << " -> "
-            << vistaLinea(lista) << std::endl;
+        log << "  final += ";
+        escribirValor(log, valores[i]);
+        log << " -> " << vistaLinea(lista) << '\n';
     }
 
-    log << "Insertando 3 elementos al inicio:" << std::endl;
-    for (int i = 3; i < 6; ++i) {
+    log << "Insertando " << alInicio << " elementos al inicio:\n";
+    for (; i < alFinal + alInicio; ++i) {
         lista.insertar_inicio(valores[i]);
-        log << "  inicio += " << formatearValor(valores[i]) << " -> "
-            << vistaLinea(lista) << std::endl;
+        log << "  inicio += ";
+        escribirValor(log, valores[i]);
+        log << " -> " << vistaLinea(lista) << '\n';
     }
 
-    log << "Insertando 4 elementos en posiciones intermedias:" << std::endl;
-    for (int i = 6; i < 10; ++i) {
+    log << "Insertando " << intermedios << " elementos en posiciones intermedias:\n";
+    for (; i < total; ++i) {
         int tamActual = lista.getTam();
         int pos = tamActual / 2;
         try {
             lista.insertar_pos(valores[i], pos);
-            log << "  pos(" << pos << ") += " << formatearValor(valores[i]) << " -> "
-                << vistaLinea(lista) << std::endl;
+            log << "  pos(" << pos << ") += ";
+            escribirValor(log, valores[i]);
+            log << " -> " << vistaLinea(lista) << '\n';
         } catch (const std::out_of_range& e) {
-            log << "  pos(" << pos << ") += " << formatearValor(valores[i])
-                << " fallo: " << e.what() << std::endl;
+            log << "  pos(" << pos << ") += ";
+            escribirValor(log, valores[i]);
+            log << " fallo: " << e.what() << '\n';
         }
     }
 
-    log << "Resultado inicial de " << nombreLista << ": " << vistaLinea(lista) << std::endl;
-    return log.str();
+    log << "Resultado inicial de " << nombreLista << ": " << vistaLinea(lista) << '\n';
 }
 
+// Aplica las operaciones principales sobre la lista y escribe cada resultado en log.
 template <typename T>
-std::string procesarLista(const std::string& nombreLista,
-                          Lista<T>& lista,
-                          const EscenarioConfig<T>& cfg) {
-    std::ostringstream log;
+void procesarLista(const std::string& nombreLista,
+                   Lista<T>& lista,
+                   const EscenarioConfig<T>& cfg,
+                   std::ostream& log) {
+    MarcaFaseTraza fase(lista.getTraza(), lista.getIdTraza(), FaseTraza::Procesado);
 
-    log << "\n=== " << nombreLista << " ===" << std::endl;
-    log << "Lista inicial: " << vistaLinea(lista) << std::endl;
-    log << "Tamano inicial: " << lista.getTam() << std::endl;
-    log << "¿Lista vacia?: " << (lista.Lista_Vacia() ? "si" : "no") << std::endl;
+    log << "\n=== " << nombreLista << " ===" << '\n';
+    log << "Lista inicial: " << vistaLinea(lista) << '\n';
+    log << "Tamano inicial: " << lista.getTam() << '\n';
+    log << "¿Lista vacia?: " << (lista.Lista_Vacia() ? "si" : "no") << '\n';
 
     if (!lista.Lista_Vacia()) {
-        log << "Primer elemento: " << formatearValor(lista.obtenerDato(0)) << std::endl;
+        log << "Primer elemento: " << formatearValor(lista.obtenerDato(0)) << '\n';
         log << "Ultimo elemento: "
-            << formatearValor(lista.obtenerDato(lista.getTam() - 1)) << std::endl;
+            << formatearValor(lista.obtenerDato(lista.getTam() - 1)) << '\n';
     }
 
     int posFuera = lista.getTam();
@@ -176,55 +269,55 @@ std::string procesarLista(const std::string& nombreLista,
         T lecturaFuera = lista.obtenerDato(posFuera);
         log << "Dato en posicion " << posFuera
             << " (fuera de rango, regresa valor por defecto): "
-            << formatearValor(lecturaFuera) << std::endl;
+            << formatearValor(lecturaFuera) << '\n';
     } catch (const std::out_of_range& e) {
         log << "Dato en posicion " << posFuera
-            << " (fuera de rango, lanza excepcion): " << e.what() << std::endl;
+            << " (fuera de rango, lanza excepcion): " << e.what() << '\n';
     }
 
     if (cfg.posicionObjetivo >= 0 && cfg.posicionObjetivo < lista.getTam()) {
         log << "Dato en posicion " << cfg.posicionObjetivo << ": "
-            << formatearValor(lista.obtenerDato(cfg.posicionObjetivo)) << std::endl;
+            << formatearValor(lista.obtenerDato(cfg.posicionObjetivo)) << '\n';
     } else {
         log << "Posicion " << cfg.posicionObjetivo
-            << " no valida para obtener dato." << std::endl;
+            << " no valida para obtener dato." << '\n';
     }
 
     if (cfg.eliminarInvalida) {
         int posInvalida = lista.getTam() + 5;
         bool eliminadoInvalido = lista.Eliminar(posInvalida);
         log << "Intento eliminar posicion invalida " << posInvalida
-            << (eliminadoInvalido ? " (exitoso)" : " (fallido)") << std::endl;
+            << (eliminadoInvalido ? " (exitoso)" : " (fallido)") << '\n';
     }
 
     bool eliminado = lista.Eliminar(cfg.posicionObjetivo);
     log << "Eliminar posicion " << cfg.posicionObjetivo
-        << (eliminado ? " (exitoso)" : " (fallido)") << std::endl;
+        << (eliminado ? " (exitoso)" : " (fallido)") << '\n';
 
     if (cfg.posicionObjetivo >= 0 && cfg.posicionObjetivo < lista.getTam()) {
         log << "Dato tras eliminar en posicion " << cfg.posicionObjetivo
-            << ": " << formatearValor(lista.obtenerDato(cfg.posicionObjetivo)) << std::endl;
+            << ": " << formatearValor(lista.obtenerDato(cfg.posicionObjetivo)) << '\n';
     } else {
         log << "Posicion " << cfg.posicionObjetivo
-            << " quedo fuera de rango tras eliminar." << std::endl;
+            << " quedo fuera de rango tras eliminar." << '\n';
     }
 
     bool modificado = lista.modificar(cfg.posicionObjetivo, cfg.valorModificado);
     log << "Modificar posicion " << cfg.posicionObjetivo
-        << (modificado ? " (exitoso)" : " (fallido)") << std::endl;
+        << (modificado ? " (exitoso)" : " (fallido)") << '\n';
 
     int posModInvalida = lista.getTam();
     bool modInvalido = lista.modificar(posModInvalida, cfg.valorModificado);
     log << "Modificar posicion invalida " << posModInvalida
-        << (modInvalido ? " (exitoso)" : " (fallido)") << std::endl;
+        << (modInvalido ? " (exitoso)" : " (fallido)") << '\n';
 
     if (modificado) {
         if (cfg.posicionObjetivo >= 0 && cfg.posicionObjetivo < lista.getTam()) {
             log << "Dato modificado en posicion " << cfg.posicionObjetivo
-                << ": " << formatearValor(lista.obtenerDato(cfg.posicionObjetivo)) << std::endl;
+                << ": " << formatearValor(lista.obtenerDato(cfg.posicionObjetivo)) << '\n';
         } else {
             log << "Posicion " << cfg.posicionObjetivo
-                << " no disponible tras modificar." << std::endl;
+                << " no disponible tras modificar." << '\n';
         }
     }
 
@@ -237,31 +330,32 @@ std::string procesarLista(const std::string& nombreLista,
     }
 
     lista.insertar_inicio(cfg.valorInicio);
-    log << "Insertar al inicio el valor: " << formatearValor(cfg.valorInicio) << std::endl;
+    log << "Insertar al inicio el valor: " << formatearValor(cfg.valorInicio) << '\n';
     lista.insertar_final(cfg.valorFinal);
-    log << "Insertar al final el valor: " << formatearValor(cfg.valorFinal) << std::endl;
+    log << "Insertar al final el valor: " << formatearValor(cfg.valorFinal) << '\n';
     try {
         lista.insertar_pos(cfg.valorMedio, posicionInsercion);
         log << "Insertar valor " << formatearValor(cfg.valorMedio)
-            << " en posicion " << posicionInsercion << " (exitoso)" << std::endl;
+            << " en posicion " << posicionInsercion << " (exitoso)" << '\n';
     } catch (const std::out_of_range& e) {
         log << "Insertar valor " << formatearValor(cfg.valorMedio)
-            << " en posicion " << posicionInsercion << " fallo: " << e.what() << std::endl;
+            << " en posicion " << posicionInsercion << " fallo: " << e.what() << '\n';
     }
 
-    log << "Lista final: " << vistaLinea(lista) << std::endl;
-    log << "Tamano final: " << lista.getTam() << std::endl;
-
-    return log.str();
+    log << "Lista final: " << vistaLinea(lista) << '\n';
+    log << "Tamano final: " << lista.getTam() << '\n';
 }
 
 template <typename T>
 void actualizarEscenario(EstadoEscenario<T>& estado) {
     Lista<T> lista;
-    estado.resultado.registroPreparacion =
-        llenarLista(estado.nombre, lista, estado.config.valores);
-    estado.resultado.registroOperaciones =
-        procesarLista(estado.nombre, lista, estado.config);
+    lista.setTraza(estado.traza);
+    std::ostringstream preparacion;
+    llenarLista(estado.nombre, lista, estado.config.valores, preparacion);
+    estado.resultado.registroPreparacion = preparacion.str();
+    std::ostringstream operaciones;
+    procesarLista(estado.nombre, lista, estado.config, operaciones);
+    estado.resultado.registroOperaciones = operaciones.str();
     estado.resultado.estadoFinal = vistaLinea(lista);
     estado.resultado.tamFinal = lista.getTam();
     estado.necesitaActualizar = false;
@@ -274,6 +368,183 @@ void asegurarActualizado(EstadoEscenario<T>& estado) {
     }
 }
 
+// ---------- Escenarios generados a gran escala ----------
+
+enum class TipoGeneracion {
+    Aleatorio,   // Valores uniformes.
+    Ordenado,    // Valores uniformes en orden ascendente.
+    Adversario,  // Pocos valores distintos en orden descendente (muchas repeticiones).
+    Archivo      // Valores leídos de un archivo de texto separado por espacios.
+};
+
+struct EscenarioGenerado {
+    TipoGeneracion tipo;
+    std::size_t cantidad;       // Con Archivo, 0 lee todos los valores.
+    unsigned semilla;
+    std::string rutaEntrada;    // Solo con Archivo.
+    std::string rutaRegistro;   // Destino del registro en disco.
+};
+
+struct TiemposEscenario {
+    double generacionMs{};
+    double llenadoMs{};
+    double procesadoMs{};
+    double escrituraMs{};   // Vaciado final del búfer del registro.
+};
+
+struct ResultadoGenerado {
+    TiemposEscenario tiempos;
+    std::size_t cantidadValores{};
+    int tamFinal{};
+    std::size_t bytesRegistro{};
+};
+
+// Registro en disco con un búfer grande: las líneas se acumulan en memoria y se
+// escriben en bloques, nunca se guarda el registro completo.
+class RegistroArchivo {
+    std::vector<char> bufer;   // Declarado antes que archivo: debe vivir más.
+    std::ofstream archivo;
+
+public:
+    explicit RegistroArchivo(const std::string& ruta, std::size_t tamBufer = 1 << 20)
+        : bufer(tamBufer) {
+        archivo.rdbuf()->pubsetbuf(bufer.data(), static_cast<std::streamsize>(bufer.size()));
+        archivo.open(ruta, std::ios::trunc);
+    }
+
+    bool valido() const { return static_cast<bool>(archivo); }
+    std::ostream& flujo() { return archivo; }
+
+    // Vacía el búfer, cierra el archivo y devuelve los bytes escritos.
+    std::size_t cerrar() {
+        archivo.flush();
+        std::streamoff bytes = archivo.tellp();
+        archivo.close();
+        return bytes > 0 ? static_cast<std::size_t>(bytes) : 0;
+    }
+};
+
+using Reloj = std::chrono::steady_clock;
+
+double milisegundosDesde(Reloj::time_point inicio) {
+    return std::chrono::duration<double, std::milli>(Reloj::now() - inicio).count();
+}
+
+template <typename T>
+T valorAleatorio(std::mt19937& gen);
+
+template <>
+int valorAleatorio<int>(std::mt19937& gen) {
+    return std::uniform_int_distribution<int>(-1000000, 1000000)(gen);
+}
+
+template <>
+double valorAleatorio<double>(std::mt19937& gen) {
+    return std::uniform_real_distribution<double>(-1000000.0, 1000000.0)(gen);
+}
+
+template <>
+char valorAleatorio<char>(std::mt19937& gen) {
+    return static_cast<char>('a' + std::uniform_int_distribution<int>(0, 25)(gen));
+}
+
+template <typename T>
+bool generarValores(const EscenarioGenerado& spec, std::vector<T>& valores, std::string& error) {
+    valores.clear();
+    if (spec.tipo == TipoGeneracion::Archivo) {
+        std::ifstream entrada(spec.rutaEntrada);
+        if (!entrada) {
+            error = "no se pudo abrir " + spec.rutaEntrada;
+            return false;
+        }
+        T valor{};
+        while ((spec.cantidad == 0 || valores.size() < spec.cantidad) && entrada >> valor) {
+            valores.push_back(valor);
+        }
+        // Si la lectura se detuvo antes del final y sin llegar a la cantidad
+        // pedida, el siguiente elemento no es un valor de tipo T.
+        if (entrada.fail() && !entrada.eof()) {
+            entrada.clear();
+            std::string invalido;
+            entrada >> invalido;
+            error = "valor invalido '" + invalido + "' en la posicion " +
+                    std::to_string(valores.size() + 1) + " de " + spec.rutaEntrada;
+            return false;
+        }
+        if (valores.empty()) {
+            error = "el archivo no contiene valores validos";
+            return false;
+        }
+        return true;
+    }
+
+    std::mt19937 gen(spec.semilla);
+    valores.reserve(spec.cantidad);
+    if (spec.tipo == TipoGeneracion::Adversario) {
+        std::array<T, 4> pocos{};
+        for (T& v : pocos) {
+            v = valorAleatorio<T>(gen);
+        }
+        for (std::size_t i = 0; i < spec.cantidad; ++i) {
+            valores.push_back(pocos[i % pocos.size()]);
+        }
+        std::sort(valores.begin(), valores.end(), [](const T& a, const T& b) { return b < a; });
+        return true;
+    }
+
+    for (std::size_t i = 0; i < spec.cantidad; ++i) {
+        valores.push_back(valorAleatorio<T>(gen));
+    }
+    if (spec.tipo == TipoGeneracion::Ordenado) {
+        std::sort(valores.begin(), valores.end());
+    }
+    return true;
+}
+
+// Corre llenarLista y procesarLista con valores generados y la configuración
+// del escenario, enviando el registro a disco y midiendo cada fase.
+template <typename T>
+bool ejecutarEscenarioGenerado(const EstadoEscenario<T>& estado,
+                               const EscenarioGenerado& spec,
+                               ResultadoGenerado& resultado,
+                               std::string& error) {
+    Reloj::time_point inicio = Reloj::now();
+    std::vector<T> valores;
+    if (!generarValores(spec, valores, error)) {
+        return false;
+    }
+    resultado.tiempos.generacionMs = milisegundosDesde(inicio);
+    resultado.cantidadValores = valores.size();
+
+    RegistroArchivo registro(spec.rutaRegistro);
+    if (!registro.valido()) {
+        error = "no se pudo abrir " + spec.rutaRegistro;
+        return false;
+    }
+
+    Lista<T> lista;
+    lista.setTraza(estado.traza);
+
+    inicio = Reloj::now();
+    llenarLista(estado.nombre, lista, valores, registro.flujo());
+    resultado.tiempos.llenadoMs = milisegundosDesde(inicio);
+    std::vector<T>().swap(valores);   // Los valores ya están en la lista.
+
+    inicio = Reloj::now();
+    procesarLista(estado.nombre, lista, estado.config, registro.flujo());
+    resultado.tiempos.procesadoMs = milisegundosDesde(inicio);
+    resultado.tamFinal = lista.getTam();
+
+    inicio = Reloj::now();
+    resultado.bytesRegistro = registro.cerrar();
+    resultado.tiempos.escrituraMs = milisegundosDesde(inicio);
+    if (resultado.bytesRegistro == 0) {
+        error = "no se pudo escribir el registro en " + spec.rutaRegistro;
+        return false;
+    }
+    return true;
+}
+
 // ---------- Entrada de datos ----------
 
 int solicitarEntero(const std::string& prompt, int actual) {
@@ -316,6 +587,16 @@ char solicitarChar(const std::string& prompt, char actual) {
     }
 }
 
+std::string solicitarTexto(const std::string& prompt, const std::string& actual) {
+    std::cout << prompt << " (actual: " << actual << "): ";
+    std::string entrada;
+    if (std::getline(std::cin >> std::ws, entrada) && !entrada.empty()) {
+        return entrada;
+    }
+    std::cin.clear();
+    return actual;
+}
+
 template <typename T>
 T solicitarValor(const std::string& prompt, T actual);
 
@@ -527,7 +808,89 @@ void menuConfiguracion(EstadoEscenario<int>& enteros,
     } while (opcion != 4);
 }
 
-int main() {
+template <typename T>
+void correrEscenarioGenerado(const EstadoEscenario<T>& estado, const EscenarioGenerado& spec) {
+    std::cout << "Ejecutando " << estado.nombre << "...\n";
+    ResultadoGenerado resultado;
+    std::string error;
+    if (!ejecutarEscenarioGenerado(estado, spec, resultado, error)) {
+        std::cout << "Error: " << error << "\n";
+        return;
+    }
+    std::cout << "\n=== Escenario generado: " << estado.nombre << " ===\n";
+    std::cout << "Valores: " << resultado.cantidadValores
+              << ", tamano final: " << resultado.tamFinal << "\n";
+    std::cout << "Registro: " << spec.rutaRegistro << " (" << resultado.bytesRegistro << " bytes)\n";
+    std::cout << "Tiempo generacion: " << resultado.tiempos.generacionMs << " ms\n";
+    std::cout << "Tiempo llenado: " << resultado.tiempos.llenadoMs << " ms\n";
+    std::cout << "Tiempo procesado: " << resultado.tiempos.procesadoMs << " ms\n";
+    std::cout << "Tiempo escritura final: " << resultado.tiempos.escrituraMs << " ms\n";
+}
+
+void menuEscenarioGenerado(const EstadoEscenario<int>& enteros,
+                           const EstadoEscenario<double>& reales,
+                           const EstadoEscenario<char>& caracteres) {
+    std::cout << "\n=== Escenario generado (gran escala) ===" << std::endl;
+    std::cout << "Se usan las posiciones y valores de operacion del escenario elegido." << std::endl;
+    int tipoLista = solicitarEntero("Tipo de lista (1=enteros, 2=reales, 3=caracteres)", 1);
+    if (tipoLista < 1 || tipoLista > 3) {
+        std::cout << "Opcion no valida.\n";
+        return;
+    }
+    int generacion = solicitarEntero(
+        "Generacion (1=aleatoria, 2=ordenada, 3=adversaria, 4=desde archivo)", 1);
+    if (generacion < 1 || generacion > 4) {
+        std::cout << "Opcion no valida.\n";
+        return;
+    }
+
+    EscenarioGenerado spec{TipoGeneracion::Aleatorio, 1000000, 42, "", "escenario.log"};
+    spec.tipo = static_cast<TipoGeneracion>(generacion - 1);
+    if (spec.tipo == TipoGeneracion::Archivo) {
+        spec.rutaEntrada = solicitarTexto("Archivo de valores", "valores.txt");
+        spec.cantidad = 0;
+    }
+    int cantidad = solicitarEntero(spec.tipo == TipoGeneracion::Archivo
+                                       ? "Cantidad maxima de valores (0 = todos)"
+                                       : "Cantidad de valores",
+                                   static_cast<int>(spec.cantidad));
+    if (cantidad < 0 || (cantidad == 0 && spec.tipo != TipoGeneracion::Archivo)) {
+        std::cout << "Cantidad no valida.\n";
+        return;
+    }
+    spec.cantidad = static_cast<std::size_t>(cantidad);
+    if (spec.tipo != TipoGeneracion::Archivo) {
+        spec.semilla = static_cast<unsigned>(solicitarEntero("Semilla", static_cast<int>(spec.semilla)));
+    }
+    spec.rutaRegistro = solicitarTexto("Archivo de registro", spec.rutaRegistro);
+
+    switch (tipoLista) {
+        case 1:
+            correrEscenarioGenerado(enteros, spec);
+            break;
+        case 2:
+            correrEscenarioGenerado(reales, spec);
+            break;
+        default:
+            correrEscenarioGenerado(caracteres, spec);
+            break;
+    }
+}
+
+int main(int argc, char* argv[]) {
+    // "--traza <archivo>" graba en binario las operaciones de todos los escenarios.
+    std::unique_ptr<GrabadorTraza> traza;
+    for (int i = 1; i < argc; ++i) {
+        std::string argumento = argv[i];
+        if (argumento == "--traza" && i + 1 < argc) {
+            traza.reset(new GrabadorTraza(argv[++i]));
+            if (!traza->valido()) {
+                std::cerr << "No se pudo abrir el archivo de traza.\n";
+                return 1;
+            }
+        }
+    }
+
     EstadoEscenario<int> escenarioEnteros{
         "Lista de enteros",
         obtenerConfigPorDefecto<int>(),
@@ -549,6 +912,10 @@ int main() {
         {},
         true};
 
+    escenarioEnteros.traza = traza.get();
+    escenarioReales.traza = traza.get();
+    escenarioCaracteres.traza = traza.get();
+
     bool salir = false;
     while (!salir) {
         std::cout << "\n=== Menu principal (Lista) ===" << std::endl;
@@ -557,7 +924,8 @@ int main() {
         std::cout << "3. Ver estado final de las listas" << std::endl;
         std::cout << "4. Configurar escenarios" << std::endl;
         std::cout << "5. Restaurar configuraciones por defecto" << std::endl;
-        std::cout << "6. Salir" << std::endl;
+        std::cout << "6. Ejecutar escenario generado (gran escala)" << std::endl;
+        std::cout << "7. Salir" << std::endl;
         std::cout << "Elige una opcion: ";
 
         int opcion = 0;
@@ -599,6 +967,9 @@ int main() {
                 std::cout << "Configuraciones restauradas.\n";
                 break;
             case 6:
+                menuEscenarioGenerado(escenarioEnteros, escenarioReales, escenarioCaracteres);
+                break;
+            case 7:
                 std::cout << "Saliendo...\n";
                 salir = true;
                 break;
@@ -608,5 +979,14 @@ int main() {
         }
     }
 
+    if (traza && !traza->cerrar()) {
+        if (traza->idsAgotados()) {
+            std::cerr << "La traza supero " << GrabadorTraza::MAX_LISTAS
+                      << " listas y quedo incompleta.\n";
+        } else {
+            std::cerr << "Error al escribir el archivo de traza: la traza esta incompleta.\n";
+        }
+        return 1;
+    }
     return 0;
 }
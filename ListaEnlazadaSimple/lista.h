@@ -1,7 +1,14 @@
 #ifndef LISTA_H
 #define LISTA_H
 
+#include <cstddef>
+#include <cstdint>
 #include <iostream>
+#include <iterator>
+#include <memory>
+
+#include "indice_valores.h"
+#include "traza.h"
 
 template <class T>
 struct Nodo {
@@ -15,13 +22,58 @@ class Lista {
     Nodo<T>* cab;    // Primer nodo de la lista.
     Nodo<T>* cola;   // Último nodo de la lista.
     int tam;         // Cantidad de elementos.
+    GrabadorTraza* traza;   // Grabador opcional de operaciones (nullptr si no se graba).
+    std::uint16_t idTraza;  // Id de la lista dentro de la traza.
+    std::unique_ptr<IndiceLista<T>> indice;  // Índice opcional valor -> nodo anterior.
+
+    // Enlazan un nodo nuevo en los extremos sin grabar la operación.
+    void enlazar_inicio(const T& dato);
+    void enlazar_final(const T& dato);
+    // Quita y libera el nodo que sigue a anterior (la cabeza si anterior es nullptr).
+    void desenlazar(Nodo<T>* anterior);
+    // Busca algún nodo con el valor (sin índice, el primero); devuelve false si no existe.
+    bool localizar(const T& valor, Nodo<T>*& anterior) const;
 
 public:
+    // Iterador de solo lectura que avanza por los enlaces `sig` (O(1) por paso).
+    class Iterador {
+        const Nodo<T>* actual;
+
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const T*;
+        using reference = const T&;
+
+        Iterador() : actual(nullptr) {}
+        explicit Iterador(const Nodo<T>* nodo) : actual(nodo) {}
+
+        reference operator*() const { return actual->info; }
+        pointer operator->() const { return &actual->info; }
+        Iterador& operator++() {
+            actual = actual->sig;
+            return *this;
+        }
+        Iterador operator++(int) {
+            Iterador previo = *this;
+            actual = actual->sig;
+            return previo;
+        }
+        bool operator==(const Iterador& otro) const { return actual == otro.actual; }
+        bool operator!=(const Iterador& otro) const { return actual != otro.actual; }
+    };
+
     // Construye una lista vacía.
     Lista();
     // Libera la memoria de todos los nodos.
     ~Lista();
 
+    // Registra en el grabador todas las operaciones siguientes (nullptr deja de grabar).
+    void setTraza(GrabadorTraza* grabador);
+    GrabadorTraza* getTraza() const { return traza; }
+    std::uint16_t getIdTraza() const { return idTraza; }
+
     // Devuelve la cantidad de elementos almacenados.
     int getTam() const { return tam; }
     // Indica si la lista está vacía.
@@ -43,13 +95,35 @@ public:
 
         // Recorre e imprime todos los valores almacenados en el flujo indicado.
         void imprimir(std::ostream& out = std::cout) const;
+
+    // Crea el índice por valor a partir del contenido actual (requiere std::hash<T>).
+    // Con el índice activo contiene, buscar y eliminar_valor son O(1) esperado;
+    // sin él recorren la lista.
+    void activarIndice();
+    void desactivarIndice() { indice.reset(); }
+    bool tieneIndice() const { return indice != nullptr; }
+    const IndiceLista<T>* getIndice() const { return indice.get(); }
+
+    // Indica si algún nodo almacena el valor.
+    bool contiene(const T& valor) const;
+    // Devuelve algún dato almacenado igual al valor, o nullptr si no existe.
+    const T* buscar(const T& valor) const;
+    // Elimina un nodo con el valor. Si hay varios, cuál se elimina no está
+    // especificado (con o sin índice); quien necesite uno en particular debe
+    // usar Eliminar(pos).
+    bool eliminar_valor(const T& valor);
+
+    // Recorrido secuencial (for de rango, algoritmos y vistas de vistas.h).
+    Iterador begin() const { return Iterador(cab); }
+    Iterador end() const { return Iterador(nullptr); }
 };
 
 template <class T>
-Lista<T>::Lista() : cab(nullptr), cola(nullptr), tam(0) {}
+Lista<T>::Lista() : cab(nullptr), cola(nullptr), tam(0), traza(nullptr), idTraza(0) {}
 
 template <class T>
 Lista<T>::~Lista() {
+    setTraza(nullptr);
     Nodo<T>* actual = cab;
     while (actual != nullptr) {
         Nodo<T>* siguiente = actual->sig;
@@ -61,14 +135,49 @@ Lista<T>::~Lista() {
     tam = 0;
 }
 
+template <class T>
+void Lista<T>::setTraza(GrabadorTraza* grabador) {
+    if (traza != nullptr) {
+        traza->bajaLista(idTraza);
+    }
+    traza = grabador;
+    if (traza != nullptr) {
+        idTraza = traza->registrarLista<T>();
+    }
+}
+
 template <class T>
 bool Lista<T>::Lista_Vacia() const {
     return tam == 0;
 }
 
+template <class T>
+void Lista<T>::activarIndice() {
+    indice.reset(new IndiceHash<T>());
+    Nodo<T>* anterior = nullptr;
+    for (Nodo<T>* actual = cab; actual != nullptr; actual = actual->sig) {
+        indice->agregar(actual->info, anterior);
+        anterior = actual;
+    }
+}
+
 template <class T>
 void Lista<T>::insertar_inicio(const T& dato) {
+    if (traza != nullptr) {
+        traza->operacionValor(OpTraza::InsertarInicio, idTraza, dato);
+    }
+    enlazar_inicio(dato);
+}
+
+template <class T>
+void Lista<T>::enlazar_inicio(const T& dato) {
     Nodo<T>* nuevo = new Nodo<T>{dato, cab};
+    if (indice) {
+        if (cab != nullptr) {
+            indice->cambiarAnterior(cab->info, nullptr, nuevo);
+        }
+        indice->agregar(dato, nullptr);
+    }
     cab = nuevo;
     if (tam == 0) {
         cola = nuevo;
@@ -78,7 +187,18 @@ void Lista<T>::insertar_inicio(const T& dato) {
 
 template <class T>
 void Lista<T>::insertar_final(const T& dato) {
+    if (traza != nullptr) {
+        traza->operacionValor(OpTraza::InsertarFinal, idTraza, dato);
+    }
+    enlazar_final(dato);
+}
+
+template <class T>
+void Lista<T>::enlazar_final(const T& dato) {
     Nodo<T>* nuevo = new Nodo<T>{dato, nullptr};
+    if (indice) {
+        indice->agregar(dato, cola);
+    }
     if (Lista_Vacia()) {
         cab = cola = nuevo;
     } else {
@@ -90,12 +210,15 @@ void Lista<T>::insertar_final(const T& dato) {
 
 template <class T>
 void Lista<T>::insertar_pos(const T& infoNueva, int pos) {
+    if (traza != nullptr) {
+        traza->operacionPosValor(OpTraza::InsertarPos, idTraza, pos, infoNueva);
+    }
     if (pos <= 0 || Lista_Vacia()) {
-        insertar_inicio(infoNueva);
+        enlazar_inicio(infoNueva);
         return;
     }
     if (pos >= tam) {
-        insertar_final(infoNueva);
+        enlazar_final(infoNueva);
         return;
     }
 
@@ -105,12 +228,19 @@ void Lista<T>::insertar_pos(const T& infoNueva, int pos) {
     }
 
     Nodo<T>* nuevo = new Nodo<T>{infoNueva, anterior->sig};
+    if (indice) {
+        indice->cambiarAnterior(anterior->sig->info, anterior, nuevo);
+        indice->agregar(infoNueva, anterior);
+    }
     anterior->sig = nuevo;
     ++tam;
 }
 
 template <class T>
 T Lista<T>::obtenerDato(int pos) const {
+    if (traza != nullptr) {
+        traza->operacionPos(OpTraza::ObtenerDato, idTraza, pos);
+    }
     if (pos < 0 || pos >= tam) {
         return T{};
     }
@@ -123,38 +253,59 @@ T Lista<T>::obtenerDato(int pos) const {
 
 template <class T>
 bool Lista<T>::modificar(int pos, const T& infoNueva) {
+    if (traza != nullptr) {
+        traza->operacionPosValor(OpTraza::Modificar, idTraza, pos, infoNueva);
+    }
     if (pos < 0 || pos >= tam) {
         return false;
     }
+    Nodo<T>* anterior = nullptr;
     Nodo<T>* actual = cab;
     for (int i = 0; i < pos; ++i) {
+        anterior = actual;
         actual = actual->sig;
     }
     if (actual == nullptr) {
         return false;
     }
+    if (indice) {
+        indice->quitar(actual->info, anterior);
+        indice->agregar(infoNueva, anterior);
+    }
     actual->info = infoNueva;
     return true;
 }
 
 template <class T>
 bool Lista<T>::Eliminar(int pos) {
+    if (traza != nullptr) {
+        traza->operacionPos(OpTraza::Eliminar, idTraza, pos);
+    }
     if (pos < 0 || pos >= tam || Lista_Vacia()) {
         return false;
     }
 
+    Nodo<T>* anterior = nullptr;
+    if (pos > 0) {
+        anterior = cab;
+        for (int i = 0; i < pos - 1; ++i) {
+            anterior = anterior->sig;
+        }
+    }
+    desenlazar(anterior);
+    return true;
+}
+
+template <class T>
+void Lista<T>::desenlazar(Nodo<T>* anterior) {
     Nodo<T>* eliminado = nullptr;
-    if (pos == 0) {
+    if (anterior == nullptr) {
         eliminado = cab;
         cab = cab->sig;
         if (cab == nullptr) {
             cola = nullptr;
         }
     } else {
-        Nodo<T>* anterior = cab;
-        for (int i = 0; i < pos - 1; ++i) {
-            anterior = anterior->sig;
-        }
         eliminado = anterior->sig;
         anterior->sig = eliminado->sig;
         if (anterior->sig == nullptr) {
@@ -162,8 +313,62 @@ bool Lista<T>::Eliminar(int pos) {
         }
     }
 
+    if (indice) {
+        indice->quitar(eliminado->info, anterior);
+        if (eliminado->sig != nullptr) {
+            indice->cambiarAnterior(eliminado->sig->info, eliminado, anterior);
+        }
+    }
     delete eliminado;
     --tam;
+}
+
+template <class T>
+bool Lista<T>::localizar(const T& valor, Nodo<T>*& anterior) const {
+    if (indice) {
+        return indice->buscar(valor, anterior);
+    }
+    anterior = nullptr;
+    for (Nodo<T>* actual = cab; actual != nullptr; actual = actual->sig) {
+        if (actual->info == valor) {
+            return true;
+        }
+        anterior = actual;
+    }
+    return false;
+}
+
+template <class T>
+bool Lista<T>::contiene(const T& valor) const {
+    if (traza != nullptr) {
+        traza->operacionValor(OpTraza::Contiene, idTraza, valor);
+    }
+    Nodo<T>* anterior = nullptr;
+    return localizar(valor, anterior);
+}
+
+template <class T>
+const T* Lista<T>::buscar(const T& valor) const {
+    if (traza != nullptr) {
+        traza->operacionValor(OpTraza::Buscar, idTraza, valor);
+    }
+    Nodo<T>* anterior = nullptr;
+    if (!localizar(valor, anterior)) {
+        return nullptr;
+    }
+    return (anterior == nullptr) ? &cab->info : &anterior->sig->info;
+}
+
+template <class T>
+bool Lista<T>::eliminar_valor(const T& valor) {
+    if (traza != nullptr) {
+        traza->operacionValor(OpTraza::EliminarValor, idTraza, valor);
+    }
+    Nodo<T>* anterior = nullptr;
+    if (!localizar(valor, anterior)) {
+        return false;
+    }
+    desenlazar(anterior);
     return true;
 }
 
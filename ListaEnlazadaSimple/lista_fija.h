@@ -0,0 +1,192 @@
+#ifndef LISTA_FIJA_H
+#define LISTA_FIJA_H
+
+#include <array>
+#include <iostream>
+
+// Nodo de ListaFija: el enlace es un índice dentro del arreglo (-1 = nullptr).
+template <class T>
+struct NodoFijo {
+    T info;    // Información almacenada en el nodo.
+    int sig;   // Índice del siguiente nodo.
+};
+
+template <class T, int N>
+// Lista enlazada simple de capacidad fija con la misma interfaz que Lista<T>.
+// Los nodos viven en un arreglo interno y los libres se encadenan en una lista
+// de índices, así que nunca usa el heap y todas las operaciones (salvo imprimir)
+// son constexpr: una ListaFija puede construirse completa en tiempo de compilación.
+// T debe ser un tipo literal con constructor por defecto.
+class ListaFija {
+    static_assert(N > 0, "ListaFija necesita capacidad positiva");
+
+    std::array<NodoFijo<T>, N> nodos;
+    int cab;     // Índice del primer nodo (-1 si está vacía).
+    int cola;    // Índice del último nodo (-1 si está vacía).
+    int libre;   // Primer nodo de la lista de libres (-1 si está llena).
+    int tam;     // Cantidad de elementos.
+
+    constexpr int tomarNodo(const T& dato, int siguiente) {
+        int indice = libre;
+        libre = nodos[indice].sig;
+        nodos[indice].info = dato;
+        nodos[indice].sig = siguiente;
+        return indice;
+    }
+
+    constexpr void liberarNodo(int indice) {
+        nodos[indice].info = T{};
+        nodos[indice].sig = libre;
+        libre = indice;
+    }
+
+    constexpr int nodoEn(int pos) const {
+        int actual = cab;
+        for (int i = 0; i < pos; ++i) {
+            actual = nodos[actual].sig;
+        }
+        return actual;
+    }
+
+public:
+    // Construye una lista vacía con todos los nodos en la lista de libres.
+    constexpr ListaFija() : nodos{}, cab(-1), cola(-1), libre(0), tam(0) {
+        for (int i = 0; i < N; ++i) {
+            nodos[i].sig = (i + 1 < N) ? i + 1 : -1;
+        }
+    }
+
+    // Devuelve la cantidad de elementos almacenados.
+    constexpr int getTam() const { return tam; }
+    // Cantidad máxima de elementos.
+    constexpr int capacidad() const { return N; }
+    // Indica si la lista está vacía.
+    constexpr bool Lista_Vacia() const { return tam == 0; }
+    // Indica si ya no quedan nodos libres.
+    constexpr bool Lista_Llena() const { return tam == N; }
+
+    // Las inserciones devuelven false (sin modificar la lista) si está llena.
+
+    // Inserta un nuevo dato al inicio de la lista.
+    constexpr bool insertar_inicio(const T& dato);
+    // Inserta un nuevo dato al final de la lista.
+    constexpr bool insertar_final(const T& dato);
+    // Inserta un nuevo dato en la posición solicitada (ajustando a los límites).
+    constexpr bool insertar_pos(const T& infoNueva, int pos);
+
+    // Obtiene el dato almacenado en la posición indicada (devuelve T{} si es inválida).
+    constexpr T obtenerDato(int pos) const;
+    // Modifica el contenido de la posición indicada.
+    constexpr bool modificar(int pos, const T& infoNueva);
+    // Elimina el nodo de la posición indicada.
+    constexpr bool Eliminar(int pos);
+
+    // Recorre e imprime todos los valores almacenados en el flujo indicado.
+    void imprimir(std::ostream& out = std::cout) const;
+};
+
+template <class T, int N>
+constexpr bool ListaFija<T, N>::insertar_inicio(const T& dato) {
+    if (Lista_Llena()) {
+        return false;
+    }
+    cab = tomarNodo(dato, cab);
+    if (tam == 0) {
+        cola = cab;
+    }
+    ++tam;
+    return true;
+}
+
+template <class T, int N>
+constexpr bool ListaFija<T, N>::insertar_final(const T& dato) {
+    if (Lista_Llena()) {
+        return false;
+    }
+    int nuevo = tomarNodo(dato, -1);
+    if (Lista_Vacia()) {
+        cab = cola = nuevo;
+    } else {
+        nodos[cola].sig = nuevo;
+        cola = nuevo;
+    }
+    ++tam;
+    return true;
+}
+
+template <class T, int N>
+constexpr bool ListaFija<T, N>::insertar_pos(const T& infoNueva, int pos) {
+    if (pos <= 0 || Lista_Vacia()) {
+        return insertar_inicio(infoNueva);
+    }
+    if (pos >= tam) {
+        return insertar_final(infoNueva);
+    }
+    if (Lista_Llena()) {
+        return false;
+    }
+
+    int anterior = nodoEn(pos - 1);
+    nodos[anterior].sig = tomarNodo(infoNueva, nodos[anterior].sig);
+    ++tam;
+    return true;
+}
+
+template <class T, int N>
+constexpr T ListaFija<T, N>::obtenerDato(int pos) const {
+    if (pos < 0 || pos >= tam) {
+        return T{};
+    }
+    return nodos[nodoEn(pos)].info;
+}
+
+template <class T, int N>
+constexpr bool ListaFija<T, N>::modificar(int pos, const T& infoNueva) {
+    if (pos < 0 || pos >= tam) {
+        return false;
+    }
+    nodos[nodoEn(pos)].info = infoNueva;
+    return true;
+}
+
+template <class T, int N>
+constexpr bool ListaFija<T, N>::Eliminar(int pos) {
+    if (pos < 0 || pos >= tam || Lista_Vacia()) {
+        return false;
+    }
+
+    int eliminado = -1;
+    if (pos == 0) {
+        eliminado = cab;
+        cab = nodos[cab].sig;
+        if (cab == -1) {
+            cola = -1;
+        }
+    } else {
+        int anterior = nodoEn(pos - 1);
+        eliminado = nodos[anterior].sig;
+        nodos[anterior].sig = nodos[eliminado].sig;
+        if (nodos[anterior].sig == -1) {
+            cola = anterior;
+        }
+    }
+
+    liberarNodo(eliminado);
+    --tam;
+    return true;
+}
+
+template <class T, int N>
+void ListaFija<T, N>::imprimir(std::ostream& out) const {
+    int actual = cab;
+    while (actual != -1) {
+        out << nodos[actual].info;
+        if (nodos[actual].sig != -1) {
+            out << " ";
+        }
+        actual = nodos[actual].sig;
+    }
+    out << std::endl;
+}
+
+#endif // LISTA_FIJA_H
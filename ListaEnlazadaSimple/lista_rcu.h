@@ -0,0 +1,338 @@
+#ifndef LISTA_RCU_H
+#define LISTA_RCU_H
+
+#include <atomic>
+#include <cstdint>
+#include <iostream>
+#include <vector>
+
+// Lista enlazada simple de lectura mayoritaria (read-copy-update).
+//
+// - Un único hilo escritor llama a insertar_*, modificar y Eliminar.
+// - Cualquier cantidad de hilos lectores (hasta MAX_LECTORES a la vez) leen a
+//   través de ListaRCU<T>::Lector sin tomar ningún candado: recorren enlaces
+//   `sig` publicados atómicamente y cada operación de lectura es libre de espera.
+// - modificar no cambia un nodo publicado: publica una copia y retira el original.
+// - Los nodos retirados se liberan cuando ningún lector activo puede verlos
+//   (periodo de gracia por épocas).
+//
+// Los métodos de lectura de la propia lista (obtenerDato, imprimir, ...) son del
+// hilo escritor, que nunca compite consigo mismo al liberar memoria.
+
+template <class T>
+struct NodoRCU {
+    T info;                          // Información (inmutable una vez publicada).
+    std::atomic<NodoRCU<T>*> sig;    // Enlace publicado al siguiente nodo.
+
+    NodoRCU(const T& dato, NodoRCU<T>* siguiente) : info(dato), sig(siguiente) {}
+};
+
+template <class T>
+class ListaRCU {
+public:
+    static constexpr int MAX_LECTORES = 64;
+
+private:
+    // Marca de un lector que no está dentro de una lectura.
+    static constexpr std::uint64_t INACTIVO = ~static_cast<std::uint64_t>(0);
+
+    // Cada ranura ocupa su propia línea de caché para que los lectores no se estorben.
+    struct alignas(64) RanuraLector {
+        std::atomic<std::uint64_t> epoca{INACTIVO};
+        std::atomic<bool> ocupada{false};
+    };
+
+    struct Retirado {
+        NodoRCU<T>* nodo;
+        std::uint64_t epoca;   // Época global en la que dejó de ser alcanzable.
+    };
+
+    std::atomic<NodoRCU<T>*> cab;   // Primer nodo publicado.
+    NodoRCU<T>* cola;               // Último nodo (solo lo usa el escritor).
+    std::atomic<int> tam;           // Cantidad de elementos publicada.
+
+    std::atomic<std::uint64_t> epocaGlobal;
+    mutable RanuraLector ranuras[MAX_LECTORES];   // Estado de lectores, no de la lista.
+    std::vector<Retirado> retirados;   // Pendientes de liberar (solo escritor).
+
+    // Enlace que apunta a la posición indicada (cab para la posición 0).
+    std::atomic<NodoRCU<T>*>& enlaceHacia(int pos, NodoRCU<T>*& anterior) {
+        anterior = nullptr;
+        std::atomic<NodoRCU<T>*>* enlace = &cab;
+        for (int i = 0; i < pos; ++i) {
+            anterior = enlace->load(std::memory_order_relaxed);
+            enlace = &anterior->sig;
+        }
+        return *enlace;
+    }
+
+    void retirar(NodoRCU<T>* nodo);
+    void reclamar();
+
+public:
+    // Acceso de lectura para un hilo lector. Ocupa una ranura mientras vive;
+    // cada hilo lector debe crear el suyo y no compartirlo.
+    class Lector {
+        const ListaRCU<T>* lista;
+        int ranura;
+
+        void entrar() const {
+            std::uint64_t e = lista->epocaGlobal.load(std::memory_order_acquire);
+            lista->ranuras[ranura].epoca.store(e, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+        }
+        void salir() const {
+            lista->ranuras[ranura].epoca.store(INACTIVO, std::memory_order_release);
+        }
+
+    public:
+        explicit Lector(const ListaRCU<T>& l);
+        ~Lector();
+        Lector(const Lector&) = delete;
+        Lector& operator=(const Lector&) = delete;
+
+        // Indica si se consiguió ranura (false si ya hay MAX_LECTORES activos).
+        bool valido() const { return ranura >= 0; }
+
+        int getTam() const { return lista->tam.load(std::memory_order_acquire); }
+
+        // Obtiene el dato de la posición indicada (devuelve T{} si es inválida
+        // o si el lector no es válido).
+        T obtenerDato(int pos) const;
+
+        // Aplica f a cada dato en orden dentro de una sola lectura (no hace nada
+        // si el lector no es válido).
+        template <class F>
+        void recorrer(F f) const {
+            if (!valido()) {
+                return;
+            }
+            entrar();
+            for (NodoRCU<T>* actual = lista->cab.load(std::memory_order_acquire);
+                 actual != nullptr;
+                 actual = actual->sig.load(std::memory_order_acquire)) {
+                f(actual->info);
+            }
+            salir();
+        }
+    };
+
+    // Construye una lista vacía.
+    ListaRCU();
+    // Libera todos los nodos; no debe haber lectores activos.
+    ~ListaRCU();
+    ListaRCU(const ListaRCU&) = delete;
+    ListaRCU& operator=(const ListaRCU&) = delete;
+
+    // Devuelve la cantidad de elementos almacenados.
+    int getTam() const { return tam.load(std::memory_order_relaxed); }
+    // Indica si la lista está vacía.
+    bool Lista_Vacia() const;
+
+    // Inserta un nuevo dato al inicio de la lista.
+    void insertar_inicio(const T& dato);
+    // Inserta un nuevo dato al final de la lista.
+    void insertar_final(const T& dato);
+    // Inserta un nuevo dato en la posición solicitada (ajustando a los límites).
+    void insertar_pos(const T& infoNueva, int pos);
+
+    // Obtiene el dato almacenado en la posición indicada (devuelve T{} si es inválida).
+    T obtenerDato(int pos) const;
+    // Publica una copia del nodo con el nuevo contenido y retira el original.
+    bool modificar(int pos, const T& infoNueva);
+    // Desenlaza el nodo de la posición indicada y lo retira.
+    bool Eliminar(int pos);
+
+    // Recorre e imprime todos los valores almacenados en el flujo indicado.
+    void imprimir(std::ostream& out = std::cout) const;
+
+    // Cantidad de nodos retirados que todavía esperan su periodo de gracia.
+    std::size_t pendientesDeLiberar() const { return retirados.size(); }
+};
+
+template <class T>
+ListaRCU<T>::Lector::Lector(const ListaRCU<T>& l) : lista(&l), ranura(-1) {
+    for (int i = 0; i < MAX_LECTORES; ++i) {
+        bool libre = false;
+        if (lista->ranuras[i].ocupada.compare_exchange_strong(libre, true,
+                                                              std::memory_order_acq_rel)) {
+            ranura = i;
+            break;
+        }
+    }
+}
+
+template <class T>
+ListaRCU<T>::Lector::~Lector() {
+    if (ranura >= 0) {
+        lista->ranuras[ranura].ocupada.store(false, std::memory_order_release);
+    }
+}
+
+template <class T>
+T ListaRCU<T>::Lector::obtenerDato(int pos) const {
+    if (!valido() || pos < 0) {
+        return T{};
+    }
+    entrar();
+    NodoRCU<T>* actual = lista->cab.load(std::memory_order_acquire);
+    for (int i = 0; i < pos && actual != nullptr; ++i) {
+        actual = actual->sig.load(std::memory_order_acquire);
+    }
+    T dato = (actual != nullptr) ? actual->info : T{};
+    salir();
+    return dato;
+}
+
+template <class T>
+ListaRCU<T>::ListaRCU() : cab(nullptr), cola(nullptr), tam(0), epocaGlobal(0) {}
+
+template <class T>
+ListaRCU<T>::~ListaRCU() {
+    NodoRCU<T>* actual = cab.load(std::memory_order_relaxed);
+    while (actual != nullptr) {
+        NodoRCU<T>* siguiente = actual->sig.load(std::memory_order_relaxed);
+        delete actual;
+        actual = siguiente;
+    }
+    for (const Retirado& r : retirados) {
+        delete r.nodo;
+    }
+}
+
+template <class T>
+bool ListaRCU<T>::Lista_Vacia() const {
+    return getTam() == 0;
+}
+
+template <class T>
+void ListaRCU<T>::retirar(NodoRCU<T>* nodo) {
+    // Los lectores que entren después del incremento ya no pueden alcanzar el nodo.
+    std::uint64_t epoca = epocaGlobal.fetch_add(1, std::memory_order_seq_cst);
+    retirados.push_back(Retirado{nodo, epoca});
+    reclamar();
+}
+
+template <class T>
+void ListaRCU<T>::reclamar() {
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    std::uint64_t minima = INACTIVO;
+    for (int i = 0; i < MAX_LECTORES; ++i) {
+        std::uint64_t e = ranuras[i].epoca.load(std::memory_order_acquire);
+        if (e < minima) {
+            minima = e;
+        }
+    }
+    // Un nodo retirado en la época e es seguro si todo lector activo entró después de e.
+    std::size_t conservados = 0;
+    for (std::size_t i = 0; i < retirados.size(); ++i) {
+        if (retirados[i].epoca < minima) {
+            delete retirados[i].nodo;
+        } else {
+            retirados[conservados++] = retirados[i];
+        }
+    }
+    retirados.resize(conservados);
+}
+
+template <class T>
+void ListaRCU<T>::insertar_inicio(const T& dato) {
+    NodoRCU<T>* nuevo = new NodoRCU<T>(dato, cab.load(std::memory_order_relaxed));
+    cab.store(nuevo, std::memory_order_release);
+    if (cola == nullptr) {
+        cola = nuevo;
+    }
+    tam.fetch_add(1, std::memory_order_release);
+}
+
+template <class T>
+void ListaRCU<T>::insertar_final(const T& dato) {
+    NodoRCU<T>* nuevo = new NodoRCU<T>(dato, nullptr);
+    if (cola == nullptr) {
+        cab.store(nuevo, std::memory_order_release);
+    } else {
+        cola->sig.store(nuevo, std::memory_order_release);
+    }
+    cola = nuevo;
+    tam.fetch_add(1, std::memory_order_release);
+}
+
+template <class T>
+void ListaRCU<T>::insertar_pos(const T& infoNueva, int pos) {
+    if (pos <= 0 || Lista_Vacia()) {
+        insertar_inicio(infoNueva);
+        return;
+    }
+    if (pos >= getTam()) {
+        insertar_final(infoNueva);
+        return;
+    }
+
+    NodoRCU<T>* anterior = nullptr;
+    std::atomic<NodoRCU<T>*>& enlace = enlaceHacia(pos, anterior);
+    NodoRCU<T>* nuevo = new NodoRCU<T>(infoNueva, enlace.load(std::memory_order_relaxed));
+    enlace.store(nuevo, std::memory_order_release);
+    tam.fetch_add(1, std::memory_order_release);
+}
+
+template <class T>
+T ListaRCU<T>::obtenerDato(int pos) const {
+    if (pos < 0 || pos >= getTam()) {
+        return T{};
+    }
+    NodoRCU<T>* actual = cab.load(std::memory_order_relaxed);
+    for (int i = 0; i < pos; ++i) {
+        actual = actual->sig.load(std::memory_order_relaxed);
+    }
+    return actual->info;
+}
+
+template <class T>
+bool ListaRCU<T>::modificar(int pos, const T& infoNueva) {
+    if (pos < 0 || pos >= getTam()) {
+        return false;
+    }
+    NodoRCU<T>* anterior = nullptr;
+    std::atomic<NodoRCU<T>*>& enlace = enlaceHacia(pos, anterior);
+    NodoRCU<T>* viejo = enlace.load(std::memory_order_relaxed);
+    NodoRCU<T>* copia = new NodoRCU<T>(infoNueva, viejo->sig.load(std::memory_order_relaxed));
+    enlace.store(copia, std::memory_order_release);
+    if (cola == viejo) {
+        cola = copia;
+    }
+    retirar(viejo);
+    return true;
+}
+
+template <class T>
+bool ListaRCU<T>::Eliminar(int pos) {
+    if (pos < 0 || pos >= getTam()) {
+        return false;
+    }
+    NodoRCU<T>* anterior = nullptr;
+    std::atomic<NodoRCU<T>*>& enlace = enlaceHacia(pos, anterior);
+    NodoRCU<T>* eliminado = enlace.load(std::memory_order_relaxed);
+    enlace.store(eliminado->sig.load(std::memory_order_relaxed), std::memory_order_release);
+    if (cola == eliminado) {
+        cola = anterior;
+    }
+    tam.fetch_sub(1, std::memory_order_release);
+    retirar(eliminado);
+    return true;
+}
+
+template <class T>
+void ListaRCU<T>::imprimir(std::ostream& out) const {
+    NodoRCU<T>* actual = cab.load(std::memory_order_relaxed);
+    while (actual != nullptr) {
+        out << actual->info;
+        NodoRCU<T>* siguiente = actual->sig.load(std::memory_order_relaxed);
+        if (siguiente != nullptr) {
+            out << " ";
+        }
+        actual = siguiente;
+    }
+    out << std::endl;
+}
+
+#endif // LISTA_RCU_H
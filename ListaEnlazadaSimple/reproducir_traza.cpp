@@ -0,0 +1,443 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "lista.h"
+#include "lista_fija.h"
+#include "lista_rcu.h"
+
+// Reproduce a máxima velocidad una traza grabada con GrabadorTraza contra una
+// variante de lista y reporta el rendimiento y los percentiles de latencia.
+//
+//   g++ -std=c++17 -O2 reproducir_traza.cpp -o reproducir_traza
+//   ./reproducir_traza traza.bin [--variante lista|indice|rcu|fija] [--repeticiones N]
+
+// ---------- Lectura de la traza ----------
+
+struct OperacionTraza {
+    OpTraza op;
+    std::uint16_t lista;
+    std::int32_t pos;
+    std::uint8_t tipo;              // Solo en AltaLista.
+    unsigned char valor[8];
+};
+
+struct InfoListaTraza {
+    std::uint8_t tipo{0};
+    std::uint8_t tamDato{0};
+};
+
+class LectorTraza {
+    std::vector<char> datos;
+    std::size_t cursor{0};
+
+    bool leerBytes(void* destino, std::size_t n) {
+        if (cursor + n > datos.size()) {
+            return false;
+        }
+        std::memcpy(destino, datos.data() + cursor, n);
+        cursor += n;
+        return true;
+    }
+
+public:
+    // Carga el archivo completo en memoria para no medir la E/S durante la reproducción.
+    bool cargar(const std::string& ruta, std::string& error) {
+        std::ifstream entrada(ruta, std::ios::binary);
+        if (!entrada) {
+            error = "no se pudo abrir " + ruta;
+            return false;
+        }
+        datos.assign(std::istreambuf_iterator<char>(entrada), std::istreambuf_iterator<char>());
+        char cabecera[4];
+        std::uint8_t version = 0;
+        if (!leerBytes(cabecera, sizeof(cabecera)) ||
+            std::memcmp(cabecera, CABECERA_TRAZA, sizeof(cabecera)) != 0 ||
+            !leerBytes(&version, sizeof(version))) {
+            error = "el archivo no es una traza de lista";
+            return false;
+        }
+        // La versión 2 solo agrega códigos; las trazas de la versión 1 siguen siendo válidas.
+        if (version < 1 || version > VERSION_TRAZA) {
+            error = "version de traza no soportada";
+            return false;
+        }
+        return true;
+    }
+
+    // Decodifica todos los registros; devuelve false si la traza está truncada o corrupta.
+    bool decodificar(std::vector<OperacionTraza>& ops,
+                     std::vector<InfoListaTraza>& listas,
+                     std::string& error) {
+        while (cursor < datos.size()) {
+            OperacionTraza op{};
+            std::uint8_t codigo = 0;
+            if (!leerBytes(&codigo, sizeof(codigo)) || !leerBytes(&op.lista, sizeof(op.lista))) {
+                error = "registro truncado";
+                return false;
+            }
+            op.op = static_cast<OpTraza>(codigo);
+            if (op.lista >= listas.size()) {
+                listas.resize(static_cast<std::size_t>(op.lista) + 1);
+            }
+            InfoListaTraza& info = listas[op.lista];
+
+            bool lleva_pos = false;
+            bool lleva_valor = false;
+            switch (op.op) {
+                case OpTraza::AltaLista:
+                    if (!leerBytes(&info.tipo, 1) || !leerBytes(&info.tamDato, 1)) {
+                        error = "alta de lista truncada";
+                        return false;
+                    }
+                    if (info.tamDato > sizeof(op.valor)) {
+                        error = "tamano de dato no soportado";
+                        return false;
+                    }
+                    op.tipo = info.tipo;
+                    break;
+                case OpTraza::BajaLista:
+                    break;
+                case OpTraza::InsertarInicio:
+                case OpTraza::InsertarFinal:
+                case OpTraza::Contiene:
+                case OpTraza::Buscar:
+                case OpTraza::EliminarValor:
+                    lleva_valor = true;
+                    break;
+                case OpTraza::InsertarPos:
+                case OpTraza::Modificar:
+                    lleva_pos = true;
+                    lleva_valor = true;
+                    break;
+                case OpTraza::ObtenerDato:
+                case OpTraza::Eliminar:
+                    lleva_pos = true;
+                    break;
+                case OpTraza::InicioFase:
+                case OpTraza::FinFase: {
+                    std::uint8_t fase = 0;
+                    if (!leerBytes(&fase, sizeof(fase))) {
+                        error = "marca de fase truncada";
+                        return false;
+                    }
+                    break;
+                }
+                default:
+                    error = "codigo de operacion desconocido";
+                    return false;
+            }
+            if (lleva_pos && !leerBytes(&op.pos, sizeof(op.pos))) {
+                error = "posicion truncada";
+                return false;
+            }
+            if (lleva_valor && !leerBytes(op.valor, info.tamDato)) {
+                error = "valor truncado";
+                return false;
+            }
+            ops.push_back(op);
+        }
+        return true;
+    }
+};
+
+// ---------- Ejecución contra una variante ----------
+
+// Evita que el compilador descarte las lecturas de obtenerDato.
+volatile unsigned char sumidero = 0;
+
+// Detecta si la variante ofrece búsqueda por valor (contiene / buscar / eliminar_valor).
+template <class L, class T, class = void>
+struct BuscaPorValor : std::false_type {};
+template <class L, class T>
+struct BuscaPorValor<L, T, decltype(void(std::declval<L&>().eliminar_valor(std::declval<const T&>())))>
+    : std::true_type {};
+
+class ListaReproducible {
+protected:
+    std::size_t descartadas{0};   // Inserciones rechazadas por la variante (p. ej. llena).
+
+public:
+    virtual ~ListaReproducible() = default;
+    virtual void ejecutar(const OperacionTraza& op) = 0;
+
+    std::size_t getDescartadas() const { return descartadas; }
+};
+
+template <template <class> class L, class T>
+class ListaReproducibleT : public ListaReproducible {
+    L<T> lista;
+
+    static T valorDe(const OperacionTraza& op) {
+        T valor{};
+        std::memcpy(&valor, op.valor, sizeof(T));
+        return valor;
+    }
+
+    // Ejecuta una inserción y cuenta si la variante la rechaza (las que
+    // devuelven bool, como ListaFija al estar llena).
+    template <class F>
+    void insertar(F insercion) {
+        if constexpr (std::is_same<decltype(insercion()), bool>::value) {
+            if (!insercion()) {
+                ++this->descartadas;
+            }
+        } else {
+            insercion();
+        }
+    }
+
+public:
+    void ejecutar(const OperacionTraza& op) override {
+        switch (op.op) {
+            case OpTraza::InsertarInicio:
+                insertar([&]() { return lista.insertar_inicio(valorDe(op)); });
+                break;
+            case OpTraza::InsertarFinal:
+                insertar([&]() { return lista.insertar_final(valorDe(op)); });
+                break;
+            case OpTraza::InsertarPos:
+                insertar([&]() { return lista.insertar_pos(valorDe(op), op.pos); });
+                break;
+            case OpTraza::ObtenerDato: {
+                T leido = lista.obtenerDato(op.pos);
+                unsigned char primero;
+                std::memcpy(&primero, &leido, 1);
+                sumidero = sumidero ^ primero;
+                break;
+            }
+            case OpTraza::Modificar:
+                lista.modificar(op.pos, valorDe(op));
+                break;
+            case OpTraza::Eliminar:
+                lista.Eliminar(op.pos);
+                break;
+            case OpTraza::Contiene:
+            case OpTraza::Buscar:
+            case OpTraza::EliminarValor:
+                ejecutarPorValor(op);
+                break;
+            default:
+                break;
+        }
+    }
+
+    // Las variantes sin búsqueda por valor ignoran estas operaciones.
+    void ejecutarPorValor(const OperacionTraza& op) {
+        if constexpr (BuscaPorValor<L<T>, T>::value) {
+            if (op.op == OpTraza::Contiene) {
+                sumidero = sumidero ^ static_cast<unsigned char>(lista.contiene(valorDe(op)));
+            } else if (op.op == OpTraza::Buscar) {
+                sumidero = sumidero ^ static_cast<unsigned char>(lista.buscar(valorDe(op)) != nullptr);
+            } else {
+                lista.eliminar_valor(valorDe(op));
+            }
+        } else {
+            (void)op;
+        }
+    }
+};
+
+// Lista<T> con el índice por valor activo desde su creación.
+template <class T>
+class ListaConIndice : public Lista<T> {
+public:
+    ListaConIndice() { this->activarIndice(); }
+};
+
+// ListaFija con capacidad suficiente para las trazas habituales; las
+// inserciones que excedan la capacidad se descartan y se reportan.
+template <class T>
+using ListaFijaReproduccion = ListaFija<T, 1 << 16>;
+
+template <template <class> class L>
+std::unique_ptr<ListaReproducible> crearLista(std::uint8_t tipo) {
+    switch (tipo) {
+        case TipoTraza<int>::codigo:
+            return std::unique_ptr<ListaReproducible>(new ListaReproducibleT<L, int>());
+        case TipoTraza<double>::codigo:
+            return std::unique_ptr<ListaReproducible>(new ListaReproducibleT<L, double>());
+        case TipoTraza<char>::codigo:
+            return std::unique_ptr<ListaReproducible>(new ListaReproducibleT<L, char>());
+        default:
+            return nullptr;
+    }
+}
+
+bool esOperacionDeDatos(OpTraza op) {
+    return op != OpTraza::AltaLista && op != OpTraza::BajaLista &&
+           op != OpTraza::InicioFase && op != OpTraza::FinFase;
+}
+
+using Reloj = std::chrono::steady_clock;
+
+// Resultado de una pasada de reproducción.
+struct PasadaReproduccion {
+    std::uint64_t ns;          // Tiempo de las operaciones de datos.
+    std::size_t descartadas;   // Inserciones que la variante rechazó.
+};
+
+// Nanosegundos transcurridos entre dos instantes.
+std::uint64_t nanosegundos(Reloj::time_point desde, Reloj::time_point hasta) {
+    return static_cast<std::uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(hasta - desde).count());
+}
+
+// Reproduce la traza una vez. Si latencias no es nulo mide cada operación de datos.
+// Cada lista vive entre su AltaLista y su BajaLista como en la grabación, pero
+// el reloj se detiene mientras se crea o se destruye, así que el tiempo cubre
+// solo las operaciones de datos.
+template <template <class> class L>
+PasadaReproduccion reproducir(const std::vector<OperacionTraza>& ops,
+                              std::size_t cantidadListas,
+                              std::vector<std::uint64_t>* latencias) {
+    std::vector<std::unique_ptr<ListaReproducible>> listas(cantidadListas);
+    PasadaReproduccion pasada{0, 0};
+    Reloj::time_point tramo = Reloj::now();
+    for (const OperacionTraza& op : ops) {
+        if (op.op == OpTraza::AltaLista || op.op == OpTraza::BajaLista) {
+            pasada.ns += nanosegundos(tramo, Reloj::now());
+            if (listas[op.lista]) {
+                pasada.descartadas += listas[op.lista]->getDescartadas();
+            }
+            listas[op.lista] = (op.op == OpTraza::AltaLista) ? crearLista<L>(op.tipo) : nullptr;
+            tramo = Reloj::now();
+            continue;
+        }
+        ListaReproducible* lista = listas[op.lista].get();
+        if (lista == nullptr || !esOperacionDeDatos(op.op)) {
+            continue;
+        }
+        if (latencias != nullptr) {
+            Reloj::time_point antes = Reloj::now();
+            lista->ejecutar(op);
+            Reloj::time_point despues = Reloj::now();
+            latencias->push_back(nanosegundos(antes, despues));
+        } else {
+            lista->ejecutar(op);
+        }
+    }
+    pasada.ns += nanosegundos(tramo, Reloj::now());
+    for (const std::unique_ptr<ListaReproducible>& lista : listas) {
+        if (lista) {
+            pasada.descartadas += lista->getDescartadas();
+        }
+    }
+    listas.clear();
+    return pasada;
+}
+
+// ---------- Reporte ----------
+
+std::uint64_t percentil(const std::vector<std::uint64_t>& ordenadas, double p) {
+    if (ordenadas.empty()) {
+        return 0;
+    }
+    std::size_t indice = static_cast<std::size_t>(p * static_cast<double>(ordenadas.size() - 1));
+    return ordenadas[indice];
+}
+
+template <template <class> class L>
+int ejecutarVariante(const std::string& nombre,
+                     const std::vector<OperacionTraza>& ops,
+                     std::size_t cantidadListas,
+                     int repeticiones) {
+    std::size_t operacionesDatos = 0;
+    for (const OperacionTraza& op : ops) {
+        if (esOperacionDeDatos(op.op)) {
+            ++operacionesDatos;
+        }
+    }
+
+    // Pasada(s) sin medir cada operación: el rendimiento no incluye el costo del reloj.
+    std::uint64_t mejorNs = 0;
+    std::size_t descartadas = 0;
+    for (int r = 0; r < repeticiones; ++r) {
+        PasadaReproduccion pasada = reproducir<L>(ops, cantidadListas, nullptr);
+        if (r == 0 || pasada.ns < mejorNs) {
+            mejorNs = pasada.ns;
+        }
+        descartadas = pasada.descartadas;
+    }
+
+    std::vector<std::uint64_t> latencias;
+    latencias.reserve(operacionesDatos * static_cast<std::size_t>(repeticiones));
+    for (int r = 0; r < repeticiones; ++r) {
+        reproducir<L>(ops, cantidadListas, &latencias);
+    }
+    std::sort(latencias.begin(), latencias.end());
+
+    double segundos = static_cast<double>(mejorNs) / 1e9;
+    std::cout << "Variante: " << nombre << "\n";
+    std::cout << "Operaciones: " << operacionesDatos << " (listas: " << cantidadListas << ")\n";
+    std::cout << "Tiempo (mejor de " << repeticiones << "): " << segundos * 1e3 << " ms\n";
+    std::cout << "Rendimiento: "
+              << (segundos > 0 ? static_cast<double>(operacionesDatos) / segundos : 0.0)
+              << " ops/s\n";
+    if (descartadas > 0) {
+        std::cout << "Aviso: " << descartadas << " inserciones descartadas por falta de capacidad;"
+                  << " la carga reproducida no es la de la traza\n";
+    }
+    std::cout << "Latencia (ns) p50=" << percentil(latencias, 0.50)
+              << " p90=" << percentil(latencias, 0.90)
+              << " p99=" << percentil(latencias, 0.99)
+              << " p99.9=" << percentil(latencias, 0.999)
+              << " max=" << (latencias.empty() ? 0 : latencias.back()) << "\n";
+    return 0;
+}
+
+int main(int argc, char* argv[]) {
+    if (argc < 2) {
+        std::cerr << "Uso: " << argv[0]
+                  << " <traza> [--variante lista|indice|rcu|fija] [--repeticiones N]\n";
+        return 1;
+    }
+    std::string ruta = argv[1];
+    std::string variante = "lista";
+    int repeticiones = 1;
+    for (int i = 2; i < argc; ++i) {
+        std::string argumento = argv[i];
+        if (argumento == "--variante" && i + 1 < argc) {
+            variante = argv[++i];
+        } else if (argumento == "--repeticiones" && i + 1 < argc) {
+            repeticiones = std::max(1, std::atoi(argv[++i]));
+        } else {
+            std::cerr << "Argumento desconocido: " << argumento << "\n";
+            return 1;
+        }
+    }
+
+    LectorTraza lector;
+    std::vector<OperacionTraza> ops;
+    std::vector<InfoListaTraza> listas;
+    std::string error;
+    if (!lector.cargar(ruta, error) || !lector.decodificar(ops, listas, error)) {
+        std::cerr << "Error: " << error << "\n";
+        return 1;
+    }
+
+    if (variante == "lista") {
+        return ejecutarVariante<Lista>(variante, ops, listas.size(), repeticiones);
+    }
+    if (variante == "indice") {
+        return ejecutarVariante<ListaConIndice>(variante, ops, listas.size(), repeticiones);
+    }
+    if (variante == "rcu") {
+        return ejecutarVariante<ListaRCU>(variante, ops, listas.size(), repeticiones);
+    }
+    if (variante == "fija") {
+        return ejecutarVariante<ListaFijaReproduccion>(variante, ops, listas.size(), repeticiones);
+    }
+    std::cerr << "Variante desconocida: " << variante << "\n";
+    return 1;
+}
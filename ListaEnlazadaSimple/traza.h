@@ -0,0 +1,189 @@
+#ifndef TRAZA_H
+#define TRAZA_H
+
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <type_traits>
+
+// Formato binario de la traza (en el orden de bytes nativo de la máquina que la
+// graba: solo se reproduce en máquinas con el mismo orden):
+//   cabecera: "LTRZ" + versión (1 byte)
+//   registro: código (1 byte) + id de lista (2 bytes) + argumentos del código
+// Los valores se guardan como bytes crudos de tamaño sizeof(T); el tamaño y el
+// tipo de cada lista se declaran una sola vez en el registro AltaLista.
+// Versión 1: códigos 1-10. Versión 2: agrega Contiene, Buscar y EliminarValor.
+
+enum class OpTraza : std::uint8_t {
+    AltaLista = 1,       // tipo (1 byte) + tamaño del dato (1 byte)
+    BajaLista = 2,       // sin argumentos
+    InsertarInicio = 3,  // valor
+    InsertarFinal = 4,   // valor
+    InsertarPos = 5,     // posición (4 bytes) + valor
+    ObtenerDato = 6,     // posición
+    Modificar = 7,       // posición + valor
+    Eliminar = 8,        // posición
+    InicioFase = 9,      // fase (1 byte)
+    FinFase = 10,        // fase (1 byte)
+    Contiene = 11,       // valor
+    Buscar = 12,         // valor
+    EliminarValor = 13   // valor
+};
+
+// Fases del flujo de escenarios de lista.cpp.
+enum class FaseTraza : std::uint8_t {
+    Llenado = 1,
+    Procesado = 2
+};
+
+// Código de tipo guardado en AltaLista; 0 indica un tipo que no se puede reproducir.
+template <class T>
+struct TipoTraza { static constexpr std::uint8_t codigo = 0; };
+template <>
+struct TipoTraza<int> { static constexpr std::uint8_t codigo = 1; };
+template <>
+struct TipoTraza<double> { static constexpr std::uint8_t codigo = 2; };
+template <>
+struct TipoTraza<char> { static constexpr std::uint8_t codigo = 3; };
+
+const char CABECERA_TRAZA[4] = {'L', 'T', 'R', 'Z'};
+const std::uint8_t VERSION_TRAZA = 2;
+
+// Escribe la traza de operaciones de una o varias listas en un archivo binario.
+class GrabadorTraza {
+    std::ofstream salida;
+    std::uint32_t siguienteId;   // Más ancho que el id para detectar que se agotaron.
+
+    void escribirBytes(const void* datos, std::size_t n) {
+        salida.write(static_cast<const char*>(datos), static_cast<std::streamsize>(n));
+    }
+
+    void escribirCabecera(OpTraza op, std::uint16_t lista) {
+        std::uint8_t codigo = static_cast<std::uint8_t>(op);
+        escribirBytes(&codigo, sizeof(codigo));
+        escribirBytes(&lista, sizeof(lista));
+    }
+
+    void escribirPos(int pos) {
+        std::int32_t p = static_cast<std::int32_t>(pos);
+        escribirBytes(&p, sizeof(p));
+    }
+
+    template <class T>
+    void escribirValor(const T& valor) {
+        // Los tipos no copiables byte a byte se registran sin valor (tamaño 0).
+        if constexpr (std::is_trivially_copyable<T>::value) {
+            escribirBytes(&valor, sizeof(T));
+        }
+    }
+
+public:
+    // Abre (y trunca) el archivo de traza indicado.
+    explicit GrabadorTraza(const std::string& ruta)
+        : salida(ruta, std::ios::binary | std::ios::trunc), siguienteId(0) {
+        escribirBytes(CABECERA_TRAZA, sizeof(CABECERA_TRAZA));
+        escribirBytes(&VERSION_TRAZA, sizeof(VERSION_TRAZA));
+    }
+
+    GrabadorTraza(const GrabadorTraza&) = delete;
+    GrabadorTraza& operator=(const GrabadorTraza&) = delete;
+
+    // Cantidad máxima de listas que se pueden registrar (los ids ocupan 2 bytes).
+    static constexpr std::uint32_t MAX_LISTAS = 65536;
+
+    // Indica si el archivo se abrió y se ha escrito sin errores.
+    bool valido() const { return static_cast<bool>(salida); }
+    // Indica si se intentó registrar más de MAX_LISTAS listas.
+    bool idsAgotados() const { return siguienteId > MAX_LISTAS; }
+
+    // Da de alta una lista de tipo T y devuelve el id con el que se registrarán sus operaciones.
+    // Pasadas MAX_LISTAS listas el id se repetiría, así que la traza deja de
+    // escribirse y queda inválida (ver idsAgotados).
+    template <class T>
+    std::uint16_t registrarLista() {
+        if (siguienteId >= MAX_LISTAS) {
+            siguienteId = MAX_LISTAS + 1;
+            salida.setstate(std::ios::failbit);
+            return 0;
+        }
+        std::uint16_t id = static_cast<std::uint16_t>(siguienteId++);
+        escribirCabecera(OpTraza::AltaLista, id);
+        std::uint8_t tipo = TipoTraza<T>::codigo;
+        std::uint8_t tamDato = std::is_trivially_copyable<T>::value
+                                   ? static_cast<std::uint8_t>(sizeof(T))
+                                   : 0;
+        escribirBytes(&tipo, sizeof(tipo));
+        escribirBytes(&tamDato, sizeof(tamDato));
+        return id;
+    }
+
+    void bajaLista(std::uint16_t lista) {
+        escribirCabecera(OpTraza::BajaLista, lista);
+    }
+
+    // Operación con un valor como único argumento (InsertarInicio, InsertarFinal, Contiene, ...).
+    template <class T>
+    void operacionValor(OpTraza op, std::uint16_t lista, const T& valor) {
+        escribirCabecera(op, lista);
+        escribirValor(valor);
+    }
+
+    // Operación con una posición como único argumento (ObtenerDato / Eliminar).
+    void operacionPos(OpTraza op, std::uint16_t lista, int pos) {
+        escribirCabecera(op, lista);
+        escribirPos(pos);
+    }
+
+    // Operación con posición y valor (InsertarPos / Modificar).
+    template <class T>
+    void operacionPosValor(OpTraza op, std::uint16_t lista, int pos, const T& valor) {
+        escribirCabecera(op, lista);
+        escribirPos(pos);
+        escribirValor(valor);
+    }
+
+    // Marca de inicio o fin (InicioFase / FinFase) de una fase del escenario.
+    void fase(OpTraza op, std::uint16_t lista, FaseTraza f) {
+        escribirCabecera(op, lista);
+        std::uint8_t codigo = static_cast<std::uint8_t>(f);
+        escribirBytes(&codigo, sizeof(codigo));
+    }
+
+    // Escribe lo pendiente en el archivo; devuelve false si alguna escritura falló.
+    bool vaciar() {
+        salida.flush();
+        return valido();
+    }
+
+    // Vacía y cierra el archivo; devuelve false si la traza quedó incompleta.
+    bool cerrar() {
+        salida.close();
+        return valido();
+    }
+};
+
+// Marca el inicio de una fase al construirse y su fin al destruirse.
+// Con grabador nulo no hace nada.
+class MarcaFaseTraza {
+    GrabadorTraza* grabador;
+    std::uint16_t lista;
+    FaseTraza fase;
+
+public:
+    MarcaFaseTraza(GrabadorTraza* g, std::uint16_t idLista, FaseTraza f)
+        : grabador(g), lista(idLista), fase(f) {
+        if (grabador != nullptr) {
+            grabador->fase(OpTraza::InicioFase, lista, fase);
+        }
+    }
+    ~MarcaFaseTraza() {
+        if (grabador != nullptr) {
+            grabador->fase(OpTraza::FinFase, lista, fase);
+        }
+    }
+
+    MarcaFaseTraza(const MarcaFaseTraza&) = delete;
+    MarcaFaseTraza& operator=(const MarcaFaseTraza&) = delete;
+};
+
+#endif // TRAZA_H
@@ -0,0 +1,454 @@
+#ifndef VISTAS_H
+#define VISTAS_H
+
+#include <cstddef>
+#include <iostream>
+#include <iterator>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+#if __cplusplus >= 202002L
+#include <ranges>
+#endif
+#if defined(__cpp_lib_ranges)
+#define VISTAS_CON_RANGES 1
+#endif
+
+#include "lista.h"
+
+// Vistas perezosas sobre Lista<T> (o cualquier rango con begin/end):
+//
+//   lista | filtrar(pred) | transformar(f) | saltar(2) | tomar(5)
+//
+// Ninguna vista copia datos ni crea nodos: solo guardan el rango de origen (por
+// referencia) y la operación. Al consumirlas, todas las etapas se resuelven en
+// un único recorrido por los enlaces `sig`. Se consumen con un for de rango,
+// con imprimir(vista, out) o con insertarEn(destino), que agrega el resultado
+// al final de una Lista<T>. Las vistas no son dueñas de la lista de origen:
+// esta debe vivir mientras se use la vista.
+//
+// Con C++20 Lista<T> y estas vistas cumplen std::ranges::forward_range y
+// std::ranges::view, así que se combinan con std::views y std::ranges en
+// ambos sentidos (p. ej. `lista | filtrar(p) | std::views::take(3)`).
+
+// Marca común de todas las vistas de este archivo.
+#ifdef VISTAS_CON_RANGES
+struct VistaBase : std::ranges::view_base {};
+#else
+struct VistaBase {};
+#endif
+
+// Guarda la función de una vista de forma que la vista siga siendo asignable
+// aunque la función (p. ej. una lambda) no lo sea.
+template <class F>
+class CajaFuncion {
+    std::optional<F> f;
+
+public:
+    explicit CajaFuncion(F funcion) : f(std::move(funcion)) {}
+    CajaFuncion(const CajaFuncion&) = default;
+    CajaFuncion(CajaFuncion&&) = default;
+    CajaFuncion& operator=(const CajaFuncion& otra) {
+        if (this != &otra) {
+            f.reset();
+            if (otra.f) {
+                f.emplace(*otra.f);
+            }
+        }
+        return *this;
+    }
+    CajaFuncion& operator=(CajaFuncion&& otra) {
+        if (this != &otra) {
+            f.reset();
+            if (otra.f) {
+                f.emplace(std::move(*otra.f));
+            }
+        }
+        return *this;
+    }
+
+    const F& operator*() const { return *f; }
+};
+
+template <class R>
+using IteradorDe = decltype(std::declval<const R&>().begin());
+
+template <class R>
+using ValorDe = typename std::iterator_traits<IteradorDe<R>>::value_type;
+
+// ---------- Vista de un rango existente ----------
+
+template <class R>
+class VistaRef : public VistaBase {
+    const R* rango;
+
+public:
+    VistaRef() : rango(nullptr) {}
+    explicit VistaRef(const R& r) : rango(&r) {}
+
+    IteradorDe<R> begin() const { return rango->begin(); }
+    IteradorDe<R> end() const { return rango->end(); }
+};
+
+#ifdef VISTAS_CON_RANGES
+// Vista de <ranges> (p. ej. std::views::filter) usada como origen. Algunas solo
+// ofrecen begin() no constante, por eso se guarda una copia mutable.
+template <class V>
+class VistaStd : public VistaBase {
+    using Comun = decltype(std::views::common(std::declval<V>()));
+    mutable Comun vista;
+
+public:
+    VistaStd() = default;
+    explicit VistaStd(const V& v) : vista(std::views::common(V(v))) {}
+
+    std::ranges::iterator_t<Comun> begin() const { return vista.begin(); }
+    std::ranges::iterator_t<Comun> end() const { return vista.end(); }
+};
+#endif
+
+// Convierte un rango en vista: las vistas se copian (son baratas) y los
+// contenedores se toman por referencia.
+template <class R>
+auto todo(const R& r) {
+    if constexpr (std::is_base_of<VistaBase, R>::value) {
+        return r;
+    }
+#ifdef VISTAS_CON_RANGES
+    else if constexpr (std::ranges::view<R>) {
+        return VistaStd<R>(r);
+    }
+#endif
+    else {
+        return VistaRef<R>(r);
+    }
+}
+
+template <class R>
+using VistaDe = decltype(todo(std::declval<const R&>()));
+
+// ---------- filtrar ----------
+
+template <class V, class P>
+class VistaFiltro : public VistaBase {
+    V base;
+    CajaFuncion<P> pred;
+
+public:
+    class Iterador {
+        IteradorDe<V> actual;
+        IteradorDe<V> fin;
+        const P* pred;
+
+        void saltarRechazados() {
+            while (actual != fin && !(*pred)(*actual)) {
+                ++actual;
+            }
+        }
+
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = typename std::iterator_traits<IteradorDe<V>>::value_type;
+        using difference_type = std::ptrdiff_t;
+        using pointer = typename std::iterator_traits<IteradorDe<V>>::pointer;
+        using reference = typename std::iterator_traits<IteradorDe<V>>::reference;
+
+        Iterador() : actual(), fin(), pred(nullptr) {}
+        Iterador(IteradorDe<V> inicio, IteradorDe<V> final, const P* p)
+            : actual(inicio), fin(final), pred(p) {
+            saltarRechazados();
+        }
+
+        reference operator*() const { return *actual; }
+        Iterador& operator++() {
+            ++actual;
+            saltarRechazados();
+            return *this;
+        }
+        Iterador operator++(int) {
+            Iterador previo = *this;
+            ++*this;
+            return previo;
+        }
+        bool operator==(const Iterador& otro) const { return actual == otro.actual; }
+        bool operator!=(const Iterador& otro) const { return actual != otro.actual; }
+    };
+
+    VistaFiltro(V b, P p) : base(std::move(b)), pred(std::move(p)) {}
+
+    Iterador begin() const { return Iterador(base.begin(), base.end(), &*pred); }
+    Iterador end() const { return Iterador(base.end(), base.end(), &*pred); }
+};
+
+// ---------- transformar ----------
+
+template <class V, class F>
+class VistaTransformacion : public VistaBase {
+    V base;
+    CajaFuncion<F> f;
+
+public:
+    class Iterador {
+        IteradorDe<V> actual;
+        const F* f;
+
+    public:
+        // El valor se calcula al desreferenciar, así que se entrega por valor.
+        using iterator_category = std::input_iterator_tag;
+        using iterator_concept = std::forward_iterator_tag;
+        using value_type = std::decay_t<decltype(std::declval<const F&>()(
+            *std::declval<IteradorDe<V>>()))>;
+        using difference_type = std::ptrdiff_t;
+        using pointer = void;
+        using reference = value_type;
+
+        Iterador() : actual(), f(nullptr) {}
+        Iterador(IteradorDe<V> it, const F* funcion) : actual(it), f(funcion) {}
+
+        reference operator*() const { return (*f)(*actual); }
+        Iterador& operator++() {
+            ++actual;
+            return *this;
+        }
+        Iterador operator++(int) {
+            Iterador previo = *this;
+            ++actual;
+            return previo;
+        }
+        bool operator==(const Iterador& otro) const { return actual == otro.actual; }
+        bool operator!=(const Iterador& otro) const { return actual != otro.actual; }
+    };
+
+    VistaTransformacion(V b, F funcion) : base(std::move(b)), f(std::move(funcion)) {}
+
+    Iterador begin() const { return Iterador(base.begin(), &*f); }
+    Iterador end() const { return Iterador(base.end(), &*f); }
+};
+
+// ---------- tomar ----------
+
+template <class V>
+class VistaTomar : public VistaBase {
+    V base;
+    int cantidad;
+
+public:
+    class Iterador {
+        IteradorDe<V> actual;
+        IteradorDe<V> fin;
+        int restantes;
+
+        bool alFinal() const { return restantes <= 0 || actual == fin; }
+
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = typename std::iterator_traits<IteradorDe<V>>::value_type;
+        using difference_type = std::ptrdiff_t;
+        using pointer = typename std::iterator_traits<IteradorDe<V>>::pointer;
+        using reference = typename std::iterator_traits<IteradorDe<V>>::reference;
+
+        Iterador() : actual(), fin(), restantes(0) {}
+        Iterador(IteradorDe<V> inicio, IteradorDe<V> final, int n)
+            : actual(inicio), fin(final), restantes(n) {}
+
+        reference operator*() const { return *actual; }
+        Iterador& operator++() {
+            ++actual;
+            --restantes;
+            return *this;
+        }
+        Iterador operator++(int) {
+            Iterador previo = *this;
+            ++*this;
+            return previo;
+        }
+        // Todos los iteradores agotados son iguales al fin de la vista.
+        bool operator==(const Iterador& otro) const {
+            if (alFinal() || otro.alFinal()) {
+                return alFinal() && otro.alFinal();
+            }
+            return actual == otro.actual;
+        }
+        bool operator!=(const Iterador& otro) const { return !(*this == otro); }
+    };
+
+    VistaTomar(V b, int n) : base(std::move(b)), cantidad(n) {}
+
+    Iterador begin() const { return Iterador(base.begin(), base.end(), cantidad); }
+    Iterador end() const { return Iterador(base.end(), base.end(), 0); }
+};
+
+// ---------- saltar ----------
+
+template <class V>
+class VistaSaltar : public VistaBase {
+    V base;
+    int cantidad;
+
+public:
+    VistaSaltar(V b, int n) : base(std::move(b)), cantidad(n) {}
+
+    IteradorDe<V> begin() const {
+        IteradorDe<V> it = base.begin();
+        IteradorDe<V> fin = base.end();
+        for (int i = 0; i < cantidad && it != fin; ++i) {
+            ++it;
+        }
+        return it;
+    }
+    IteradorDe<V> end() const { return base.end(); }
+};
+
+// ---------- combinar (zip) ----------
+
+template <class A, class B>
+class VistaCombinar : public VistaBase {
+    A primera;
+    B segunda;
+
+public:
+    class Iterador {
+        IteradorDe<A> a;
+        IteradorDe<A> finA;
+        IteradorDe<B> b;
+        IteradorDe<B> finB;
+
+        bool alFinal() const { return a == finA || b == finB; }
+
+    public:
+        using iterator_category = std::input_iterator_tag;
+        using iterator_concept = std::forward_iterator_tag;
+        using value_type = std::pair<ValorDe<A>, ValorDe<B>>;
+        using difference_type = std::ptrdiff_t;
+        using pointer = void;
+        using reference = value_type;
+
+        Iterador() : a(), finA(), b(), finB() {}
+        Iterador(IteradorDe<A> ia, IteradorDe<A> fa, IteradorDe<B> ib, IteradorDe<B> fb)
+            : a(ia), finA(fa), b(ib), finB(fb) {}
+
+        reference operator*() const { return value_type(*a, *b); }
+        Iterador& operator++() {
+            ++a;
+            ++b;
+            return *this;
+        }
+        Iterador operator++(int) {
+            Iterador previo = *this;
+            ++*this;
+            return previo;
+        }
+        // Termina en cuanto se agota el rango más corto.
+        bool operator==(const Iterador& otro) const {
+            if (alFinal() || otro.alFinal()) {
+                return alFinal() && otro.alFinal();
+            }
+            return a == otro.a && b == otro.b;
+        }
+        bool operator!=(const Iterador& otro) const { return !(*this == otro); }
+    };
+
+    VistaCombinar(A va, B vb) : primera(std::move(va)), segunda(std::move(vb)) {}
+
+    Iterador begin() const {
+        return Iterador(primera.begin(), primera.end(), segunda.begin(), segunda.end());
+    }
+    Iterador end() const {
+        return Iterador(primera.end(), primera.end(), segunda.end(), segunda.end());
+    }
+};
+
+// ---------- Adaptadores para la sintaxis con | ----------
+
+template <class P>
+struct AdaptadorFiltrar { P pred; };
+template <class F>
+struct AdaptadorTransformar { F f; };
+struct AdaptadorTomar { int n; };
+struct AdaptadorSaltar { int n; };
+template <class V>
+struct AdaptadorCombinar { V otra; };
+
+// Conserva los elementos que cumplen pred.
+template <class P>
+AdaptadorFiltrar<P> filtrar(P pred) { return AdaptadorFiltrar<P>{std::move(pred)}; }
+
+// Entrega f(x) por cada elemento x.
+template <class F>
+AdaptadorTransformar<F> transformar(F f) { return AdaptadorTransformar<F>{std::move(f)}; }
+
+// Entrega como máximo los primeros n elementos.
+inline AdaptadorTomar tomar(int n) { return AdaptadorTomar{n}; }
+
+// Omite los primeros n elementos.
+inline AdaptadorSaltar saltar(int n) { return AdaptadorSaltar{n}; }
+
+// Entrega pares (x, y) con los elementos de ambos rangos hasta agotar el más corto.
+template <class R>
+AdaptadorCombinar<VistaDe<R>> combinar(const R& otra) {
+    return AdaptadorCombinar<VistaDe<R>>{todo(otra)};
+}
+
+template <class R, class P>
+VistaFiltro<VistaDe<R>, P> operator|(const R& r, AdaptadorFiltrar<P> a) {
+    return VistaFiltro<VistaDe<R>, P>(todo(r), std::move(a.pred));
+}
+
+template <class R, class F>
+VistaTransformacion<VistaDe<R>, F> operator|(const R& r, AdaptadorTransformar<F> a) {
+    return VistaTransformacion<VistaDe<R>, F>(todo(r), std::move(a.f));
+}
+
+template <class R>
+VistaTomar<VistaDe<R>> operator|(const R& r, AdaptadorTomar a) {
+    return VistaTomar<VistaDe<R>>(todo(r), a.n);
+}
+
+template <class R>
+VistaSaltar<VistaDe<R>> operator|(const R& r, AdaptadorSaltar a) {
+    return VistaSaltar<VistaDe<R>>(todo(r), a.n);
+}
+
+template <class R, class V>
+VistaCombinar<VistaDe<R>, V> operator|(const R& r, AdaptadorCombinar<V> a) {
+    return VistaCombinar<VistaDe<R>, V>(todo(r), std::move(a.otra));
+}
+
+// ---------- Consumidores ----------
+
+// Agrega al final de destino cada elemento del rango (un solo recorrido).
+template <class R, class T>
+void insertarEn(const R& rango, Lista<T>& destino) {
+    for (auto&& valor : rango) {
+        destino.insertar_final(valor);
+    }
+}
+
+template <class T>
+struct AdaptadorInsertarEn { Lista<T>* destino; };
+
+// Forma con |: `lista | filtrar(p) | insertarEn(destino);`
+template <class T>
+AdaptadorInsertarEn<T> insertarEn(Lista<T>& destino) { return AdaptadorInsertarEn<T>{&destino}; }
+
+template <class R, class T>
+void operator|(const R& rango, AdaptadorInsertarEn<T> a) {
+    insertarEn(rango, *a.destino);
+}
+
+// Imprime el rango con el mismo formato que Lista<T>::imprimir.
+template <class R>
+void imprimir(const R& rango, std::ostream& out = std::cout) {
+    bool primero = true;
+    for (auto&& valor : rango) {
+        if (!primero) {
+            out << " ";
+        }
+        out << valor;
+        primero = false;
+    }
+    out << std::endl;
+}
+
+#endif // VISTAS_H